@@ -1,4 +1,5 @@
 #include <graph.h>
+#include <clique.h>
 
 unsigned int ident1() 
 {
@@ -14,19 +15,7 @@ BitMap * viz_comum(Graph * const g, unsigned int u, unsigned int v)
 
 int eh_clique(Graph * const g, BitMap * const s) 
 {
-	BitMap * aux = cloneBitMap(s);
-
-	Node node;
-	for (begin(s, &node); !end(&node); next(&node)) 
-	{
-		delNode(aux, &node);
-		//delElement(aux, &node);
-		if (!isSubset(aux, neig(g, getElement(&node))))
-			return 0;
-	}
-
-	freeBitMap(aux);
-	return 1;
+	return isClique(g, s, NULL);
 }
 
 int viz_comum_eh_clique(Graph * const g, unsigned int u, unsigned int v) 
@@ -55,22 +44,9 @@ int conta_arestas(Graph * const g, BitMap * const s)
 {
 	int numArestas = 0;
 	Node node;
-    BitMap const *vizinhos;
-
-	int cardinalidade = 0;	
 
 	for(begin(s, &node); !end(&node); next(&node))
-	{
-		vizinhos = neig(g,getElement(&node));
-		BitMap *novo = newBitMap(g->n);
-		intersectOf(novo, vizinhos,s);
-
-		cardinalidade = cardOf(novo);
-
-		numArestas += cardinalidade;
-
-	}	
-	
+		numArestas += cardOfIntersection(neig(g,getElement(&node)), s);
 
 	return numArestas/2;
 }
@@ -78,8 +54,9 @@ int conta_arestas(Graph * const g, BitMap * const s)
 int viz_comum_conta_arestas(Graph * const g, unsigned int u, unsigned int v) 
 {
 	BitMap * viz = viz_comum(g, u, v);
-
-	return conta_arestas(g,viz);
+	int ret = conta_arestas(g,viz);
+	freeBitMap(viz);
+	return ret;
 }
 
 BitMap * grau_impar(Graph * const g, BitMap * const s) 
@@ -87,26 +64,15 @@ BitMap * grau_impar(Graph * const g, BitMap * const s)
 
 	BitMap *grauImpar = newBitMap(getN(g));
 	Node node;
-    BitMap const *vizinhos;
-
-	int cardinalidade = 0;	
 
 	for(begin(s, &node); !end(&node); next(&node))
 	{
-		vizinhos = neig(g,getElement(&node));
-		BitMap *novo = newBitMap(g->n);
-		intersectOf(novo, vizinhos,s);
-
-		cardinalidade = cardOf(novo);
-
-		if(cardinalidade % 2  != 0)
+		if(cardOfIntersection(neig(g,getElement(&node)), s) % 2 != 0)
 		{
 			addNode(grauImpar,&node);
 			//addElement(grauImpar,&node);
 		}
-
-	}	
-	
+	}
 
 	return grauImpar;
 }
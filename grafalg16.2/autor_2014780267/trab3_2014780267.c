@@ -1,73 +1,31 @@
 #include <graph.h>
+#include <bfs.h>
 #define true 1
 #define false 0
 #define VALOR_GRANDE 100000000
 
-int count = 0;
-
 /**Structs****/
-typedef struct V Vertice;
-typedef struct V
-{
-	Node node; //vindo de graph.h
-	int distancia;
-	Node noPartida;
-	
-};
+typedef unsigned int Vertice;
 
+/* Cursor do percurso em largura: o percurso é feito nível a nível pelo motor de bfs.h,
+   e o cursor enumera os vértices do nível corrente (a fronteira) */
 typedef struct
 {
-	Vertice vertice;
+	BFS * bfs;	//percurso, com a fronteira e os vértices ainda não alcançados
+	Node node;	//vértice corrente na fronteira
 	
 }No_Vertice_L;
 
 
+/* Cursor das arestas em largura: o motor de bfs.h entrega de uma vez, como bitmap, as arestas de cada vértice
+   para os vértices seguintes no percurso, e o cursor enumera os vizinhos do bloco corrente */
 typedef struct
 {
-	No_Vertice_L nv1;
-	No_Vertice_L nv2;
+	EdgeBFS * ebfs;	//percurso, com o bloco corrente de arestas
+	Node node;		//vizinho corrente no bloco
 	
 }No_Aresta_L;
 
-/*Funções de manipulação das structs*/
-Vertice * criar_vertice()
-{
-	Vertice *v = (Vertice *) malloc(sizeof(Vertice));
-
-	// if(v != NULL)
-	// {
-	// 	v->node = 
-	// 	//v->algumaCoisa = algumValor;
-	// }
-
-	return v;
-}
-
-No_Vertice_L *criar_No_Vertice_L()
-{
-	No_Vertice_L *nv  = (No_Vertice_L *) malloc(sizeof(No_Vertice_L));
-
-	// if(nv != NULL)
-	// {
-	// 	nv->v = -1;
-	// }
-
-	return nv;
-}
-
-No_Aresta_L *criar_No_Aresta_L()
-{
-	No_Aresta_L *na  = (No_Aresta_L *) malloc(sizeof(No_Aresta_L));
-
-	// if(na != NULL)
-	// {
-	// 	na->nv1 = -1;
-	// 	na->nv2 = -1;
-	// }
-
-	return na;
-}
-
 /*Funções*/
 
 unsigned int ident3() 
@@ -77,192 +35,96 @@ unsigned int ident3()
 
 void freeNo_Vertice_L(No_Vertice_L * no) 
 {
+	delBFS(no->bfs);
 	free(no);
 }
 
-// Vertice alvo(No_Vertice_L * const no) 
-// {
-// 	Vertice *v = criar_vertice();
-// 	v = no->vertice;
-//     return *v;
-// }
-
+//distância do vértice corrente ao vértice de partida = nível corrente do percurso
 int distancia(No_Vertice_L *const no)	
 {
-	return 0;
-
+	return no->bfs->level;
 }
 
-
-//definir o alvo como como a conjunto de valores de acordo com o percurso em largura.
-// Definir nós visitados e alcançados
-
 int alvo(No_Vertice_L * const no)
 {
-	Node *noAux = &no->vertice.node;
-	printf("alvo: %d\n",noAux->cur);
-	//count++;
-	//printf("count: %d\n",count );
-
-	return noAux->cur;
+	return getElement(&no->node);
 }
 
+//próximo vértice do nível corrente; ao fim do nível, o próximo nível é calculado
 No_Vertice_L * avancar_VL(No_Vertice_L * no) 
 {
-//	BitMap *vizinhos = newBitMap(g->n - 1);
-	//neig(Graph * const g, unsigned long long int i)
-	 // if(&no->vertice.node != NULL)
- 	printf("\navancar_VL\n");
-	next(&no->vertice.node);
+	next(&no->node);
+	if (end(&no->node) && nextLevelBFS(no->bfs) > 0)
+		begin(no->bfs->frontier, &no->node);
 	return no;
 }
 
-/*Possível objetivo do trabalho: (vide aula9-ga algoritmo PercursoLargMatriz)
-implementar os conteúdos de PARTIDA, AVANCAR e CHEGADA,
-pois já deve existir uma função PERCURSOLARGMATRIZ no script de teste
-Na verdade, devem existir dois: um para testar essas funções considerando
-os vértices e outro para considerar o caso para as arestas
-*/
-
-//tenstativa 2 de implementação... tentar pegar os vizinhos
 No_Vertice_L * partida_VL(Graph * const g, Vertice u)
 {
-	printf("partida_VL\n");
-	BitMap *vizinhos = newBitMap(g->n);
-	
-	 printNode(&u.node); 
-	Node *aux = (Node *) malloc(sizeof(Node));
-	begin(g->matrix,&u.node);
-	printNode(&u.node);
-	aux = &u.node;
-	vizinhos = neig(g, 1); //já foi getElement
-    
-  
-	Node *inicio = (Node *) malloc(sizeof(Node));
-	// if(vizinhos == NULL)
-	// 	printf("Vizinhos é NULL\n");
-	begin(vizinhos,inicio); //linha do seg fault
-  
-	No_Vertice_L *no_vertice = (No_Vertice_L *) malloc(sizeof(No_Vertice_L));
-	no_vertice->vertice.node = *inicio;
-	return no_vertice;  
+	No_Vertice_L *no = (No_Vertice_L *) malloc(sizeof(No_Vertice_L));
 
+	no->bfs = newBFS(g);
+	startBFS(no->bfs, u, NULL);
+	begin(no->bfs->frontier, &no->node);
+	return no;
 }
 
-
-//tentaiva um tanto frustrada de fazer o percursoEmlarguramatriz (possivelmente, não é o objetivo desse trabalho)
- // No_Vertice_L * partida_VL(Graph * const g, Vertice u)
- // {
- // 	BitMap F[2];
- // 	F[0] = (BitMap *) malloc(sizeof(BitMap * g->n));
- // 	F[1] = (BitMap *) malloc(sizeof(BitMap * g->n));
-
- // 	BitMap *A;
- // 	A = (BitMap *) malloc(sizeof(BitMap * g->n));
-
- // 	begin(g->matrix,&u.node);
-
- // 	//u->noPartida = u.node;
-
- // 	u->distancia = 1;
-
- //    ////provavel conteudo da fç distancia  - só falta associar u a no partida **
- // 	F[0] = neig(g,u.node->cur); //muito provável getElement em vez de node->cur
-
- // 	Node aux;
-
- // 	for (begin(F[0], &aux); !end(&aux); next(&aux))
- // 	{
- // 		Vertice v; 
- // 		v.node = aux; 
- // 		v.distancia = u.distancia;
-
- // 	}
-
- // 	//**
-
-
- // }
-
-// No_Vertice_L * partida_VL(Graph * const g, Vertice u)  //seg fault
-// {
-// 	Node aux = u.node;
-// 	printf("\npartida_VL antes: %d\n",aux.cur);
-// 	begin(g->matrix,&u.node);
-// 	aux = u.node;
-// 	BitMap * vizinhos = newBitMap(g->n -1);
-// 	vizinhos = neig(g, u.node.cur);
-// 	Node node;
-// 	for (begin(vizinhos, &node); !end(&node); next(&node)) 
-// 	{
-// 		node.cur = &u.node.cur; //se não der certo, fazer com a distância
-//     }
-
-
-
-	
-// 	printf("\npartida_VL depois: %d\n",aux.cur);
-// 	No_Vertice_L *no = criar_No_Vertice_L();
-// 	no->vertice = u;
-// 	return no;
-// }
-
 int chegada_VL(No_Vertice_L * no) 
 {
-	printf("chegada_VL\n");
-	return end(&(no->vertice.node));
+	return end(&no->node);
 }
 
+//2-coloração nível a nível do percurso em largura restrito a r; uma aresta dentro de um nível fecha um ciclo ímpar
 int eh_subbipartido(Graph * const g, BitMap const * r, BitMap * s, BitMap * t) 
 {
-	printf("É eh_subbipartido\n");
-	return 0;
+	return oddCycle(g, r, s, t, NULL) == 0;
 }
 
 int eh_bipartido(Graph * const g, BitMap * s, BitMap * t) 
 {
-	printf("eh_bipartido\n");
-	return 0;
+	return oddCycle(g, NULL, s, t, NULL) == 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
 
 void freeNo_Aresta_L(No_Aresta_L * no) 
 {
+	delEdgeBFS(no->ebfs);
 	free(no);
 }
 
 Vertice alvo_menor(No_Aresta_L * const no) 
 {
-	printf("alvo_menor\n");
-	//return 0;
-	Vertice v;
-	return v;
+	int v = getElement(&no->node);
+	return no->ebfs->u < v ? no->ebfs->u : v;
 }
 
 Vertice alvo_maior(No_Aresta_L * const no) 
 {
-	printf("alvo_maior\n");
-	//return 0;
-	Vertice v;
-	return v;
+	int v = getElement(&no->node);
+	return no->ebfs->u > v ? no->ebfs->u : v;
 }
 
 int chegada_AL(No_Aresta_L * no) 
 {
-	printf("chegada_AL\n");
-	return 0;
+	return end(&no->node);
 }
 
+//próxima aresta do bloco corrente; ao fim do bloco, o próximo bloco é calculado
 No_Aresta_L * avancar_AL(No_Aresta_L * no) 
 {
-	printf("avancar_VL\n");
-	return NULL;
+	next(&no->node);
+	if (end(&no->node) && nextEdgeBlock(no->ebfs))
+		begin(no->ebfs->edges, &no->node);
+	return no;
 }
 
 No_Aresta_L * partida_AL(Graph * const g, Vertice u) 
 {
-	printf("partida_AL\n");
-	return NULL;
-}
+	No_Aresta_L *no = (No_Aresta_L *) malloc(sizeof(No_Aresta_L));
 
+	no->ebfs = newEdgeBFS(g);
+	startEdgeBFS(no->ebfs, u, NULL);
+	begin(no->ebfs->edges, &no->node);
+	return no;
+}
@@ -0,0 +1,220 @@
+#include <stdio.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <analytics.h>
+
+#define ROWCHUNK 16 		//!< Number of rows handed to a thread at a time.
+#define TILE 64 			//!< Number of rows in a tile of the common neighbor counts.
+#define WORDCHUNK 128 		//!< Number of words of the rows combined at a time in a tile (1 KB of each row).
+
+static int numThreads(int threads) {
+#ifdef _OPENMP
+	return threads > 0 ? threads : omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+
+long long countTriangles(Graph * g, long long * t, int threads) {
+	const int n = g->n;
+	long long total = 0;
+	int u;
+
+	threads = numThreads(threads);
+	if (t == NULL) {
+#pragma omp parallel for num_threads(threads) schedule(dynamic, ROWCHUNK) reduction(+:total)
+		for (u = 0; u < n; u++) {
+			BitMap ru, rv;
+			long long tu = 0;
+			int v;
+
+			setAsViewOf(g->matrix, &ru);
+			setAsViewOf(g->matrix, &rv);
+			subMap(g->matrix, &ru, u);
+			MAPELEMENTS(&ru, v, {
+				if (v <= u)
+					continue;
+				subMap(g->matrix, &rv, v);
+				tu += cardOfIntersectionFrom(&ru, &rv, v + 1);
+			});
+			total += tu;
+		}
+	}
+	else {
+#pragma omp parallel for num_threads(threads) schedule(dynamic, ROWCHUNK) reduction(+:total)
+		for (u = 0; u < n; u++) {
+			BitMap ru, rv;
+			long long tu = 0;
+			int v;
+
+			setAsViewOf(g->matrix, &ru);
+			setAsViewOf(g->matrix, &rv);
+			subMap(g->matrix, &ru, u);
+			MAPELEMENTS(&ru, v, {
+				subMap(g->matrix, &rv, v);
+				tu += cardOfIntersection(&ru, &rv);
+			});
+			t[u] = tu >> 1;
+			total += t[u];
+		}
+		total /= 3;
+	}
+
+	return total;
+}
+
+long long vertexAnalytics(Graph * g, int * deg, long long * t, double * cc, int threads) {
+	const int n = g->n;
+	long long total = 0;
+	int u;
+
+	threads = numThreads(threads);
+#pragma omp parallel for num_threads(threads) schedule(dynamic, ROWCHUNK) reduction(+:total)
+	for (u = 0; u < n; u++) {
+		BitMap ru, rv;
+		long long tu = 0;
+		int v, du;
+
+		setAsViewOf(g->matrix, &ru);
+		setAsViewOf(g->matrix, &rv);
+		subMap(g->matrix, &ru, u);
+		du = cardOf(&ru);
+		MAPELEMENTS(&ru, v, {
+			subMap(g->matrix, &rv, v);
+			tu += cardOfIntersection(&ru, &rv);
+		});
+		tu >>= 1;
+
+		if (deg != NULL)
+			deg[u] = du;
+		if (t != NULL)
+			t[u] = tu;
+		if (cc != NULL)
+			cc[u] = du > 1 ? (2.0 * tu) / ((double) du * (du - 1)) : 0.0;
+		total += tu;
+	}
+
+	return total / 3;
+}
+
+/*
+ * Counts |N(i) & N(j)| for i in [i0, i1) and j in [j0, j1) into acc[(i-i0)*ld + (j-j0)], going through the words of the
+ * rows in chunks of WORDCHUNK, so that the two tiles of rows stay in the cache while all their pairs are combined.
+ */
+static void tileCounts(Graph * g, int i0, int i1, int j0, int j1, uint32_t * acc, int ld) {
+	const int mn = g->matrix->nRnodes << (LOGB - LOGMAPWORD);
+	const int step = g->matrix->step;
+	MAPWORD const * a;
+	MAPWORD const * b;
+	int i, j, k, k0, k1;
+	uint32_t c;
+
+	for (i = i0; i < i1; i++)
+		memset(acc + (i - i0) * ld, 0, (j1 - j0) * sizeof(uint32_t));
+	for (k0 = 0; k0 < mn; k0 += WORDCHUNK) {
+		k1 = k0 + WORDCHUNK < mn ? k0 + WORDCHUNK : mn;
+		for (i = i0; i < i1; i++) {
+			a = (MAPWORD const *) (g->matrix->R + (i << step));
+			for (j = j0; j < j1; j++) {
+				b = (MAPWORD const *) (g->matrix->R + (j << step));
+				for (c = 0, k = k0; k < k1; k++)
+					c += __builtin_popcountll(a[k] & b[k]);
+				acc[(i - i0) * ld + (j - j0)] += c;
+			}
+		}
+	}
+}
+
+/*
+ * Runs tileCounts on the tiles on and above the diagonal, and calls store for each tile with its counts.
+ */
+#define COMMONNEIGHBORS(g, threads, store) do { \
+	const int nn = (g)->n; \
+	const int nt = (nn + TILE - 1) / TILE; \
+	int t; \
+	_Pragma("omp parallel num_threads(threads)") \
+	{ \
+		uint32_t * acc = (uint32_t *) malloc(TILE * TILE * sizeof(uint32_t)); \
+		int ib, jb, i0, j0, i1, j1, i, j, r; \
+		_Pragma("omp for schedule(dynamic, 1)") \
+		for (t = 0; t < nt * (nt + 1) / 2; t++) { \
+			for (ib = 0, r = t; r >= nt - ib; r -= nt - ib, ib++); \
+			jb = ib + r; \
+			i0 = ib * TILE; \
+			i1 = i0 + TILE < nn ? i0 + TILE : nn; \
+			j0 = jb * TILE; \
+			j1 = j0 + TILE < nn ? j0 + TILE : nn; \
+			tileCounts(g, i0, i1, j0, j1, acc, TILE); \
+			for (i = i0; i < i1; i++) \
+				for (j = j0; j < j1; j++) { \
+					store(i, j, acc[(i - i0) * TILE + (j - j0)]); \
+					store(j, i, acc[(i - i0) * TILE + (j - j0)]); \
+				} \
+		} \
+		free(acc); \
+	} \
+} while (0)
+
+void commonNeighbors32(Graph * g, uint32_t * cn, int threads) {
+	const size_t n = g->n;
+#define STORE32(i, j, c) (cn[(i) * n + (j)] = (c))
+	threads = numThreads(threads);
+	COMMONNEIGHBORS(g, threads, STORE32);
+#undef STORE32
+}
+
+void commonNeighbors16(Graph * g, uint16_t * cn, int threads) {
+	const size_t n = g->n;
+#define STORE16(i, j, c) (cn[(i) * n + (j)] = (c) < 0xFFFF ? (uint16_t) (c) : 0xFFFF)
+	threads = numThreads(threads);
+	COMMONNEIGHBORS(g, threads, STORE16);
+#undef STORE16
+}
+
+void commonNeighborsTopK(Graph * g, int k, int * nb, uint32_t * cnt, int threads) {
+	const int n = g->n;
+	const int nt = (n + TILE - 1) / TILE;
+	int ib;
+
+	threads = numThreads(threads);
+#pragma omp parallel num_threads(threads)
+	{
+		uint32_t * acc = (uint32_t *) malloc((size_t) TILE * (n > 0 ? n : 1) * sizeof(uint32_t));
+		int i0, i1, j0, i, j, l, sz;
+		int * snb;
+		uint32_t * scnt;
+		uint32_t c;
+
+#pragma omp for schedule(dynamic, 1)
+		for (ib = 0; ib < nt; ib++) {
+			i0 = ib * TILE;
+			i1 = i0 + TILE < n ? i0 + TILE : n;
+			for (j0 = 0; j0 < n; j0 += TILE)
+				tileCounts(g, i0, i1, j0, j0 + TILE < n ? j0 + TILE : n, acc + j0, n);
+			for (i = i0; i < i1; i++) {
+				snb = nb + (size_t) i * k;
+				scnt = cnt + (size_t) i * k;
+				// insertion in the sorted list of the k best, which is scanned in increasing order of vertex
+				for (sz = 0, j = 0; j < n; j++) {
+					c = acc[(size_t) (i - i0) * n + j];
+					if (j == i || (sz == k && c <= scnt[k - 1]))
+						continue;
+					for (l = sz < k ? sz++ : k - 1; l > 0 && scnt[l - 1] < c; l--) {
+						snb[l] = snb[l - 1];
+						scnt[l] = scnt[l - 1];
+					}
+					snb[l] = j;
+					scnt[l] = c;
+				}
+				for (; sz < k; sz++) {
+					snb[sz] = -1;
+					scnt[sz] = 0;
+				}
+			}
+		}
+		free(acc);
+	}
+}
@@ -0,0 +1,101 @@
+/*!
+ * \file analytics.h
+ *
+ * \date Oct 18, 2026
+ * \author Ricardo C. Corrêa (correa@ufrrj.br)
+ *
+ * \brief Counting of local structures (degrees, triangles, clustering, common neighbors) of undirected graphs.
+ *
+ * All the counts reduce to the number of elements of intersections of rows of the adjacency matrix, which are
+ * computed without storing the intersections with #cardOfIntersectionFrom. The rows are distributed to the threads
+ * with OpenMP, with dynamic scheduling since the work per row is proportional to the degree.
+ * Without OpenMP (\c -fopenmp not in the \c gcc command line), the functions are sequential.
+ */
+#ifndef ANALYTICS_H_
+#define ANALYTICS_H_
+
+#include <stdint.h>
+
+#include <graph.h>
+
+/*!
+ * \fn long long countTriangles(Graph * g, long long * t, int threads)
+ * \brief Counts the triangles of a specified undirected graph.
+ *
+ * If only the total is requested, each triangle \f$\{u, v, w\}\f$ with \f$u < v < w\f$ is counted once, from the edge
+ * \f$uv\f$, as one of the elements of \f$N(u) \cap N(v)\f$ greater than \f$v\f$. Otherwise, the number of triangles
+ * of each vertex \f$v\f$ is computed as \f$\frac{1}{2} \sum_{u \in N(v)} |N(u) \cap N(v)|\f$, so that each thread
+ * writes only the counts of its own rows.
+ *
+ * \param g The graph.
+ * \param t Array of size \c n where the number of triangles containing each vertex is stored, or \c NULL.
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ *
+ * \return The number of triangles of \c g.
+ */
+long long countTriangles(Graph * g, long long * t, int threads);
+
+/*!
+ * \fn long long vertexAnalytics(Graph * g, int * deg, long long * t, double * cc, int threads)
+ * \brief Computes the degree, the number of triangles and the local clustering coefficient of all the vertices of a specified undirected graph.
+ *
+ * All the values of a vertex are computed in a single pass over its row, which is intersected with the rows of its
+ * neighbors without storing the intersections, so that no memory is allocated. The number of triangles containing
+ * a vertex \f$v\f$ is also the number of edges of the subgraph induced by \f$N(v)\f$, and the local clustering
+ * coefficient of \f$v\f$ is this number divided by \f$\binom{d(v)}{2}\f$ (0 if \f$d(v) < 2\f$).
+ *
+ * \param g The graph.
+ * \param deg Array of size \c n where the degree of each vertex is stored, or \c NULL.
+ * \param t Array of size \c n where the number of triangles containing each vertex (edges in its neighborhood) is stored, or \c NULL.
+ * \param cc Array of size \c n where the local clustering coefficient of each vertex is stored, or \c NULL.
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ *
+ * \return The number of triangles of \c g.
+ */
+long long vertexAnalytics(Graph * g, int * deg, long long * t, double * cc, int threads);
+
+/*!
+ * \fn void commonNeighbors32(Graph * g, uint32_t * cn, int threads)
+ * \brief Computes the number of common neighbors of all the pairs of vertices of a specified graph.
+ *
+ * The computation is organized as a boolean matrix product of the adjacency matrix by its transpose, where the
+ * products are logic \c AND operations on words and the sums are bit counts. The rows are processed in square tiles,
+ * and the words of the rows in chunks, so that the two tiles of rows being combined stay in the cache. Since the result
+ * is symmetric, only the tiles on and above the diagonal are computed, and the tiles are distributed to the threads.
+ *
+ * \param g The graph.
+ * \param cn Array of size \c n x \c n where \f$|N(u) \cap N(v)|\f$ is stored in \c cn[u*n+v] (the degree of \c u if \c u = \c v).
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ */
+void commonNeighbors32(Graph * g, uint32_t * cn, int threads);
+
+/*!
+ * \fn void commonNeighbors16(Graph * g, uint16_t * cn, int threads)
+ * \brief Computes the number of common neighbors of all the pairs of vertices of a specified graph in 16-bit counters.
+ *
+ * Same as #commonNeighbors32, with half of the memory for the result. Counts larger than 65535 are saturated.
+ *
+ * \param g The graph.
+ * \param cn Array of size \c n x \c n where \f$\min(|N(u) \cap N(v)|, 65535)\f$ is stored in \c cn[u*n+v].
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ */
+void commonNeighbors16(Graph * g, uint16_t * cn, int threads);
+
+/*!
+ * \fn void commonNeighborsTopK(Graph * g, int k, int * nb, uint32_t * cnt, int threads)
+ * \brief Computes, for each vertex of a specified graph, the \c k other vertices with which it has the most common neighbors.
+ *
+ * The counts of a tile of rows against all the vertices are computed as in #commonNeighbors32, in a buffer of each
+ * thread, and the \c k largest counts of each row are selected from the buffer. Ties are broken in favor of the
+ * smallest vertex. If \c n - 1 < \c k, the remaining entries are set to -1 and 0.
+ *
+ * \param g The graph.
+ * \param k The number of vertices to select for each vertex.
+ * \param nb Array of size \c n x \c k where the vertices selected for \c u are stored in \c nb[u*k], ..., \c nb[u*k+k-1],
+ * in nonincreasing order of number of common neighbors.
+ * \param cnt Array of size \c n x \c k where the corresponding numbers of common neighbors are stored.
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ */
+void commonNeighborsTopK(Graph * g, int k, int * nb, uint32_t * cnt, int threads);
+
+#endif /* ANALYTICS_H_ */
@@ -0,0 +1,400 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <bfs.h>
+
+BFS * newBFS(Graph * g) {
+	const int n = g->n > 0 ? g->n : 1;
+	BFS * b = (BFS *) malloc(sizeof(BFS));
+
+	b->g = g;
+	b->frontier = newBitMap(n);
+	b->unvisited = newBitMap(n);
+	b->next = newBitMap(n);
+	setAsViewOf(g->matrix, &b->row);
+	b->level = 0;
+	b->nf = 0;
+	b->nu = 0;
+	b->bottomup = 0;
+
+	return b;
+}
+
+void delBFS(BFS * b) {
+	freeBitMap(b->frontier);
+	freeBitMap(b->unvisited);
+	freeBitMap(b->next);
+	free(b);
+}
+
+void startBFS(BFS * b, int s, BitMap const * r) {
+	delAllElements(b->frontier);
+	addElement(b->frontier, s);
+	if (r == NULL)
+		addAllElements(b->unvisited);
+	else
+		copyAll(b->unvisited, r);
+	delElement(b->unvisited, s);
+	b->level = 0;
+	b->nf = 1;
+	b->nu = cardOf(b->unvisited);
+	b->bottomup = 0;
+}
+
+int nextLevelBFS(BFS * b) {
+	BitMap * aux;
+	Node node;
+	int v;
+
+	if (b->nf == 0)
+		return 0;
+
+	b->bottomup = b->nf * BFS_ALPHA > b->nu;
+	if (b->bottomup) {
+		delAllElements(b->next);
+		for (begin(b->unvisited, &node); !end(&node); next(&node)) {
+			v = getElement(&node);
+			subMap(b->g->matrix, &b->row, v);
+			if (!areDisjoint(&b->row, b->frontier))
+				addElement(b->next, v);
+		}
+	}
+	else {
+		unionOfRows(b->g, b->frontier, b->next);
+		retainAll(b->next, b->unvisited);
+	}
+	removeAll(b->unvisited, b->next);
+
+	aux = b->frontier;
+	b->frontier = b->next;
+	b->next = aux;
+	b->nf = cardOf(b->frontier);
+	b->nu -= b->nf;
+	if (b->nf > 0)
+		b->level++;
+
+	return b->nf;
+}
+
+EdgeBFS * newEdgeBFS(Graph * g) {
+	const int n = g->n > 0 ? g->n : 1;
+	EdgeBFS * e = (EdgeBFS *) malloc(sizeof(EdgeBFS));
+
+	e->bfs = newBFS(g);
+	e->pending = newBitMap(n);
+	e->edges = newBitMap(n);
+	setAsViewOf(g->matrix, &e->row);
+	e->u = -1;
+	e->level = 0;
+
+	return e;
+}
+
+void delEdgeBFS(EdgeBFS * e) {
+	delBFS(e->bfs);
+	freeBitMap(e->pending);
+	freeBitMap(e->edges);
+	free(e);
+}
+
+int startEdgeBFS(EdgeBFS * e, int s, BitMap const * r) {
+	startBFS(e->bfs, s, r);
+	if (r == NULL)
+		addAllElements(e->pending);
+	else
+		copyAll(e->pending, r);
+	begin(e->bfs->frontier, &e->node);
+
+	return nextEdgeBlock(e);
+}
+
+int nextEdgeBlock(EdgeBFS * e) {
+	for (;;) {
+		while (end(&e->node)) {
+			if (nextLevelBFS(e->bfs) == 0)
+				return 0;
+			begin(e->bfs->frontier, &e->node);
+		}
+		e->u = getElement(&e->node);
+		e->level = e->bfs->level;
+		next(&e->node);
+		delElement(e->pending, e->u);
+		subMap(e->bfs->g->matrix, &e->row, e->u);
+		intersectOf(e->edges, &e->row, e->pending);
+		if (isNotEmpty(e->edges))
+			return 1;
+	}
+}
+
+int bfsDistances(Graph * g, int s, int * dist) {
+	const int n = g->n;
+	BFS * b = newBFS(g);
+	Node node;
+	int v, ecc;
+
+	for (v = 0; v < n; v++)
+		dist[v] = -1;
+	startBFS(b, s, NULL);
+	do {
+		for (begin(b->frontier, &node); !end(&node); next(&node)) {
+			v = getElement(&node);
+			dist[v] = b->level;
+		}
+	} while (nextLevelBFS(b) > 0);
+	ecc = b->level;
+
+	delBFS(b);
+
+	return ecc;
+}
+
+#define LANE(a, v) ((a) + (size_t) (v) * BFS_LANEWORDS) 	//!< Lanes of vertex \c v in the array \c a of #bfsMulti.
+
+static inline int laneIsEmpty(uint64_t const * a) {
+	uint64_t x = 0;
+	int j;
+	for (j = 0; j < BFS_LANEWORDS; j++)
+		x |= a[j];
+	return x == 0;
+}
+
+static inline int laneIsFull(uint64_t const * a, uint64_t const * full) {
+	uint64_t x = 0;
+	int j;
+	for (j = 0; j < BFS_LANEWORDS; j++)
+		x |= a[j] ^ full[j];
+	return x == 0;
+}
+
+static inline void laneOr(uint64_t * a, uint64_t const * b) {
+	int j;
+	for (j = 0; j < BFS_LANEWORDS; j++)
+		a[j] |= b[j];
+}
+
+/*
+ * Accumulates in acc the lanes in visit of the neighbors of v, until acc has all the lanes of full not in seen.
+ */
+static void pullLanes(Graph * g, BitMap * row, int v, uint64_t const * visit, uint64_t const * seen,
+		uint64_t const * full, uint64_t * acc) {
+	MAPWORD const * w;
+	unsigned long long x;
+	uint64_t aux[BFS_LANEWORDS];
+	int t, j, mn;
+
+	subMap(g->matrix, row, v);
+	w = (MAPWORD const *) row->R;
+	mn = row->nRnodes << (LOGB - LOGMAPWORD);
+	memset(acc, 0, BFS_LANEWORDS * sizeof(uint64_t));
+	for (t = 0; t < mn; t++) {
+		if (w[t] == 0)
+			continue;
+		for (x = w[t]; x; x &= x - 1)
+			laneOr(acc, LANE(visit, (t << LOGMAPWORD) + __builtin_ctzll(x)));
+		for (j = 0; j < BFS_LANEWORDS; j++)
+			aux[j] = acc[j] | seen[j];
+		if (laneIsFull(aux, full))
+			break;
+	}
+}
+
+int bfsMulti(Graph * g, int const * sources, int k, int * dist) {
+	const int n = g->n;
+	const size_t sz = (size_t) (n > 0 ? n : 1) * BFS_LANEWORDS * sizeof(uint64_t);
+	uint64_t * seen = (uint64_t *) malloc(sz);
+	uint64_t * visit = (uint64_t *) malloc(sz);
+	uint64_t * nxt = (uint64_t *) malloc(sz);
+	uint64_t * aux;
+	uint64_t full[BFS_LANEWORDS];
+	uint64_t x;
+	BitMap row;
+	int b, kb, i, j, u, v, s, level, na, nu, maxd = 0;
+
+	setAsViewOf(g->matrix, &row);
+	for (b = 0; b < k; b += BFS_LANES) {
+		kb = k - b < BFS_LANES ? k - b : BFS_LANES;
+		for (j = 0; j < BFS_LANEWORDS; j++)
+			full[j] = kb >= (j + 1) << 6 ? ~0ULL : kb > j << 6 ? (1ULL << (kb - (j << 6))) - 1 : 0ULL;
+
+		// level 0: each source reaches itself
+		memset(seen, 0, sz);
+		for (i = 0; i < kb; i++) {
+			s = sources[b + i];
+			for (v = 0; v < n; v++)
+				dist[(size_t) (b + i) * n + v] = -1;
+			dist[(size_t) (b + i) * n + s] = 0;
+			LANE(seen, s)[i >> 6] |= 1ULL << (i & 63);
+		}
+		memcpy(visit, seen, sz);
+		for (na = 0, nu = 0, v = 0; v < n; v++) {
+			na += !laneIsEmpty(LANE(visit, v));
+			nu += !laneIsFull(LANE(seen, v), full);
+		}
+
+		for (level = 1; na > 0; level++) {
+			if (na * BFS_ALPHA > nu) {
+				// pull: each vertex not reached by all the sources yet looks for them in its neighborhood
+				for (v = 0; v < n; v++)
+					if (laneIsFull(LANE(seen, v), full))
+						memset(LANE(nxt, v), 0, BFS_LANEWORDS * sizeof(uint64_t));
+					else
+						pullLanes(g, &row, v, visit, LANE(seen, v), full, LANE(nxt, v));
+			}
+			else {
+				// push: the vertices reached in the last level pass their lanes to their neighbors
+				memset(nxt, 0, sz);
+				for (u = 0; u < n; u++) {
+					if (laneIsEmpty(LANE(visit, u)))
+						continue;
+					subMap(g->matrix, &row, u);
+					MAPELEMENTS(&row, v, laneOr(LANE(nxt, v), LANE(visit, u)));
+				}
+			}
+
+			// the lanes of the vertices which are new to them are the next level
+			for (na = 0, nu = 0, v = 0; v < n; v++) {
+				for (j = 0; j < BFS_LANEWORDS; j++) {
+					x = LANE(nxt, v)[j] & ~LANE(seen, v)[j];
+					LANE(nxt, v)[j] = x;
+					LANE(seen, v)[j] |= x;
+					for (; x; x &= x - 1)
+						dist[(size_t) (b + (j << 6) + __builtin_ctzll(x)) * n + v] = level;
+				}
+				if (!laneIsEmpty(LANE(nxt, v))) {
+					na++;
+					if (level > maxd)
+						maxd = level;
+				}
+				nu += !laneIsFull(LANE(seen, v), full);
+			}
+			aux = visit;
+			visit = nxt;
+			nxt = aux;
+		}
+	}
+
+	free(seen);
+	free(visit);
+	free(nxt);
+
+	return maxd;
+}
+
+/*
+ * Some neighbor of v, in the component of the search, at distance dist[v] - 1 from the source.
+ */
+static int parentOf(Graph * g, BitMap * row, int const * dist, int v) {
+	Node node;
+	int u;
+
+	subMap(g->matrix, row, v);
+	for (begin(row, &node); !end(&node); next(&node)) {
+		u = getElement(&node);
+		if (dist[u] == dist[v] - 1)
+			return u;
+	}
+	return -1;
+}
+
+/*
+ * Stores in cycle the odd cycle formed by the edge ab, inside a level of a search from s restricted to r, and
+ * the paths from a and b back to their nearest common ancestor.
+ */
+static int witness(Graph * g, BitMap const * r, int s, int a, int b, int * cycle) {
+	const int n = g->n;
+	int * dist = (int *) malloc(n * sizeof(int));
+	BFS * bfs = newBFS(g);
+	BitMap row;
+	Node node;
+	int * path;
+	int i, j, len;
+
+	for (i = 0; i < n; i++)
+		dist[i] = -1;
+	startBFS(bfs, s, r);
+	do {
+		for (begin(bfs->frontier, &node); !end(&node); next(&node))
+			dist[getElement(&node)] = bfs->level;
+	} while (nextLevelBFS(bfs) > 0);
+
+	// a and its ancestors up to the common ancestor, followed by the ancestors of b in reverse order and b
+	setAsViewOf(g->matrix, &row);
+	path = (int *) malloc((dist[a] + 1) * sizeof(int));
+	for (i = 0; a != b; i++) {
+		cycle[i] = a;
+		path[i] = b;
+		a = parentOf(g, &row, dist, a);
+		b = parentOf(g, &row, dist, b);
+	}
+	cycle[i] = a;
+	for (j = 0; j < i; j++)
+		cycle[i + 1 + j] = path[i - 1 - j];
+	len = 2 * i + 1;
+
+	free(path);
+	delBFS(bfs);
+	free(dist);
+
+	return len;
+}
+
+int oddCycle(Graph * g, BitMap const * r, BitMap * s, BitMap * t, int * cycle) {
+	const int n = g->n > 0 ? g->n : 1;
+	BitMap * remaining = newBitMap(n);
+	BitMap * frontier = newBitMap(n);
+	BitMap * nb = newBitMap(n);
+	BitMap * side[2] = { s, t };
+	BitMap * aux;
+	BitMap row;
+	Node root, node;
+	int u, a, b, l, len = 0;
+
+	if (r == NULL)
+		addAllElements(remaining);
+	else
+		copyAll(remaining, r);
+	delAllElements(s);
+	delAllElements(t);
+
+	// the enumeration of remaining skips the vertices removed by the searches of the previous components
+	for (begin(remaining, &root); len == 0 && !end(&root); next(&root)) {
+		u = getElement(&root);
+		delAllElements(frontier);
+		addElement(frontier, u);
+		delElement(remaining, u);
+		for (l = 0; isNotEmpty(frontier); l++) {
+			addAll(side[l & 1], frontier);
+			unionOfRows(g, frontier, nb);
+			if (!areDisjoint(nb, frontier)) {
+				if (cycle != NULL) {
+					// an edge ab inside the frontier
+					setAsViewOf(g->matrix, &row);
+					for (begin(frontier, &node); !end(&node); next(&node)) {
+						a = getElement(&node);
+						subMap(g->matrix, &row, a);
+						intersectOf(nb, &row, frontier);
+						if (isNotEmpty(nb))
+							break;
+					}
+					begin(nb, &node);
+					b = getElement(&node);
+					len = witness(g, r, u, a, b, cycle);
+				}
+				else
+					len = 1;
+				break;
+			}
+			retainAll(nb, remaining);
+			removeAll(remaining, nb);
+			aux = frontier;
+			frontier = nb;
+			nb = aux;
+		}
+	}
+
+	freeBitMap(remaining);
+	freeBitMap(frontier);
+	freeBitMap(nb);
+
+	return len;
+}
@@ -0,0 +1,213 @@
+/*!
+ * \file bfs.h
+ *
+ * \date Oct 18, 2026
+ * \author Ricardo C. Corrêa (correa@ufrrj.br)
+ *
+ * \brief Breadth-first search on bitmap adjacency matrices, one level at a time.
+ *
+ * The search keeps the current level (the frontier) and the vertices not reached yet as bitmaps, and each level is
+ * computed from the previous one with whole-word operations, in one of two directions:
+ * - top-down: the union of the rows of the frontier, restricted to the vertices not reached yet (#unionOfRows);
+ * - bottom-up: each vertex not reached yet joins the next level as soon as its row meets the frontier (#areDisjoint).
+ *
+ * Top-down costs one row per vertex of the frontier, and bottom-up at most one row per vertex not reached yet, but
+ * usually much less, since the scan of a row stops at the first word in common with the frontier. The direction is
+ * chosen at each level by comparing the size of the frontier with the number of vertices not reached yet.
+ *
+ * Searches from many sources are done together by #bfsMulti, where each vertex carries one bit (a lane) per source,
+ * so that a single traversal of the graph advances the searches from #BFS_LANES sources at once.
+ *
+ * The edges are enumerated in the order of the search by #nextEdgeBlock, in blocks with all the edges from a vertex
+ * to the vertices after it in the search order.
+ *
+ * The levels of a search also give a 2-coloring of a bipartite graph, and an edge inside a level shows an odd cycle
+ * (#oddCycle).
+ */
+#ifndef BFS_H_
+#define BFS_H_
+
+#include <graph.h>
+
+#if defined(_ARCH128_) || defined(_ARCH256_)
+#define BFS_LANEWORDS (BSIZE >> 6) 	//!< Number of 64-bit words of the lanes of a vertex in #bfsMulti.
+#else
+#define BFS_LANEWORDS 1
+#endif
+#define BFS_LANES (BFS_LANEWORDS << 6) 	//!< Number of sources searched at once by #bfsMulti.
+
+#define BFS_ALPHA 2 		//!< A level is computed bottom-up if the frontier has more than 1/BFS_ALPHA of the vertices not reached yet.
+
+/*!
+ * \struct BFS
+ * \brief State of a breadth-first search from a vertex of a graph.
+ */
+typedef struct {
+	Graph * 	g;				//!< The graph.
+	BitMap * 	frontier;		//!< Vertices at distance #level from the source.
+	BitMap * 	unvisited;		//!< Vertices not reached yet (the complement of the restriction set is never reached).
+	BitMap * 	next;			//!< Scratch for the next level.
+	BitMap 		row;			//!< View of the rows of the adjacency matrix.
+	int 		level;			//!< Distance from the source of the vertices in #frontier.
+	int 		nf;				//!< Number of vertices in #frontier.
+	int 		nu;				//!< Number of vertices in #unvisited.
+	int 		bottomup;		//!< Nonzero if #frontier was computed bottom-up.
+} BFS;
+
+/*!
+ * \struct EdgeBFS
+ * \brief State of an enumeration of the edges of a graph in the order of a breadth-first search.
+ *
+ * The vertices are taken in the order of the search (level by level, in increasing order in a level), and the edges
+ * of a vertex \c u are handed out at once, as the bitmap #edges of its neighbors whose edges have not been handed
+ * out yet, so that each edge of the component of the source appears exactly once. The neighbors in #edges are at
+ * level #level (those in the frontier of #bfs) or #level + 1 (the other ones).
+ */
+typedef struct {
+	BFS * 		bfs;			//!< The search, whose frontier contains #u.
+	BitMap * 	pending;		//!< Vertices whose edges have not been handed out yet.
+	BitMap * 	edges;			//!< Neighbors \c v of #u such that the edges \c uv form the current block.
+	BitMap 		row;			//!< View of the rows of the adjacency matrix.
+	Node 		node;			//!< Next vertex of the frontier.
+	int 		u;				//!< Vertex of the current block.
+	int 		level;			//!< Distance from the source of #u.
+} EdgeBFS;
+
+/*!
+ * \fn BFS * newBFS(Graph * g)
+ * \brief Creates the state of a breadth-first search in a specified graph.
+ *
+ * The state can be used for several searches, each one started with #startBFS.
+ *
+ * \param g The graph.
+ *
+ * \return The state of the search, with an empty frontier.
+ */
+BFS * newBFS(Graph * g);
+
+/*!
+ * \fn void delBFS(BFS * b)
+ * \brief Frees the state of a breadth-first search.
+ *
+ * \param b The state of the search.
+ */
+void delBFS(BFS * b);
+
+/*!
+ * \fn void startBFS(BFS * b, int s, BitMap const * r)
+ * \brief Starts a breadth-first search from a specified vertex, restricted to a specified set of vertices.
+ *
+ * After the call, the frontier is \f$\{s\}\f$, at level 0.
+ *
+ * \param b The state of the search.
+ * \param s The source vertex.
+ * \param r The set of vertices of the subgraph where the search is done (it should contain \c s), or \c NULL for the whole graph.
+ */
+void startBFS(BFS * b, int s, BitMap const * r);
+
+/*!
+ * \fn int nextLevelBFS(BFS * b)
+ * \brief Replaces the frontier of a breadth-first search by the next level.
+ *
+ * \param b The state of the search.
+ *
+ * \return The number of vertices of the new frontier, which is 0 if the search is over.
+ */
+int nextLevelBFS(BFS * b);
+
+/*!
+ * \fn EdgeBFS * newEdgeBFS(Graph * g)
+ * \brief Creates the state of an enumeration of the edges of a graph in the order of a breadth-first search.
+ *
+ * \param g The graph.
+ *
+ * \return The state of the enumeration, to be started with #startEdgeBFS.
+ */
+EdgeBFS * newEdgeBFS(Graph * g);
+
+/*!
+ * \fn void delEdgeBFS(EdgeBFS * e)
+ * \brief Frees the state of an enumeration of edges.
+ *
+ * \param e The state of the enumeration.
+ */
+void delEdgeBFS(EdgeBFS * e);
+
+/*!
+ * \fn int startEdgeBFS(EdgeBFS * e, int s, BitMap const * r)
+ * \brief Starts an enumeration of the edges of the component of a specified vertex, in the subgraph induced by a specified set.
+ *
+ * \param e The state of the enumeration.
+ * \param s The source vertex.
+ * \param r The set of vertices of the subgraph (it should contain \c s), or \c NULL for the whole graph.
+ *
+ * \return A nonzero value if there is a first block, which is then in \c e->edges, and 0 if \c s has no edges.
+ */
+int startEdgeBFS(EdgeBFS * e, int s, BitMap const * r);
+
+/*!
+ * \fn int nextEdgeBlock(EdgeBFS * e)
+ * \brief Moves an enumeration of edges to the next nonempty block.
+ *
+ * \param e The state of the enumeration.
+ *
+ * \return A nonzero value if there is a next block, which is then in \c e->edges, and 0 if the enumeration is over.
+ */
+int nextEdgeBlock(EdgeBFS * e);
+
+/*!
+ * \fn int bfsDistances(Graph * g, int s, int * dist)
+ * \brief Computes the distances from a specified vertex to all the vertices of a graph.
+ *
+ * \param g The graph.
+ * \param s The source vertex.
+ * \param dist Array of size \c n where the distance from \c s to each vertex is stored (-1 for the vertices not reachable from \c s).
+ *
+ * \return The eccentricity of \c s in its connected component.
+ */
+int bfsDistances(Graph * g, int s, int * dist);
+
+/*!
+ * \fn int bfsMulti(Graph * g, int const * sources, int k, int * dist)
+ * \brief Computes the distances from each one of specified vertices to all the vertices of a graph.
+ *
+ * The sources are processed in batches of #BFS_LANES (64 bits, or the node size with \c -D_ARCH128_ and
+ * \c -D_ARCH256_). In a batch, each vertex has a word of lanes with the sources that have already reached it and a
+ * word with the sources that reached it in the last level, and a level advances all the searches of the batch with
+ * \c OR operations of these words over the neighborhoods. If few vertices were reached in the last level, their
+ * words are pushed to their neighbors; otherwise, each vertex not reached by all the sources yet pulls the words of
+ * its neighbors, until it has all the sources.
+ *
+ * \param g The graph.
+ * \param sources The source vertices.
+ * \param k The number of sources.
+ * \param dist Array of size \c k x \c n where the distance from \c sources[i] to \c v is stored in \c dist[i*n+v]
+ * (-1 if \c v is not reachable from \c sources[i]).
+ *
+ * \return The largest distance stored in \c dist.
+ */
+int bfsMulti(Graph * g, int const * sources, int k, int * dist);
+
+/*!
+ * \fn int oddCycle(Graph * g, BitMap const * r, BitMap * s, BitMap * t, int * cycle)
+ * \brief Determines whether the subgraph induced by a specified set of vertices is bipartite.
+ *
+ * Each connected component is searched level by level from its smallest vertex, always top-down, since the union
+ * \f$N(F)\f$ of the rows of the frontier \c F is needed anyway: the subgraph is not bipartite if and only if
+ * \f$N(F) \cap F \neq \emptyset\f$ for some level. In each component, the even levels go to \c s and the odd ones to \c t. The
+ * subgraph is never built, the search is restricted to \c r with bitmap operations on the rows of \c g.
+ *
+ * If an edge \f$ab\f$ inside a level is found and a witness is requested, the distances in the component are
+ * computed again and the paths from \c a and \c b back to their nearest common ancestor are joined by \f$ab\f$.
+ *
+ * \param g The graph.
+ * \param r The set of vertices of the subgraph, or \c NULL for the whole graph.
+ * \param s Bitmap where one side of the bipartition is stored (its contents are unspecified if the subgraph is not bipartite).
+ * \param t Bitmap where the other side of the bipartition is stored (idem).
+ * \param cycle Array of size \c n where the vertices of an odd cycle are stored in order, or \c NULL.
+ *
+ * \return 0 if the subgraph is bipartite, and otherwise the length of the odd cycle stored in \c cycle (1 if \c cycle is \c NULL).
+ */
+int oddCycle(Graph * g, BitMap const * r, BitMap * s, BitMap * t, int * cycle);
+
+#endif /* BFS_H_ */
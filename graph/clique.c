@@ -0,0 +1,668 @@
+#include <stdio.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cores.h>
+#include <clique.h>
+#include <smallgraph.h>
+
+/*!
+ * \struct CliqueSearch
+ * \brief State of a branch-and-bound search for a maximum clique.
+ *
+ * The candidate set of level \c d of the search tree is row \c d of \c P. The vertices selected by the coloring of
+ * level \c d, together with their colors (or their weighted bounds), are stored in \c order[d] and \c color[d]
+ * (or \c ub[d]), which are allocated the first time the level is reached.
+ */
+typedef struct CliqueSearch {
+	Graph * 	g; 				//!< Graph renumbered in the search order.
+	BitMap * 	P; 				//!< Candidate sets, one per level.
+	BitMap * 	U; 				//!< Uncolored vertices in the coloring.
+	BitMap * 	Q; 				//!< Vertices that can receive the current color in the coloring.
+	int ** 		order; 			//!< Vertices to branch on, per level, in nondecreasing order of color.
+	int ** 		color; 			//!< Colors of the vertices in \c order, per level.
+	double ** 	ub; 			//!< Weighted coloring bounds of the vertices in \c order, per level.
+	int * 		C; 				//!< Current clique.
+	int * 		best; 			//!< Best clique found.
+	int 		szbest; 		//!< Size of the best clique found.
+	double * 	w; 				//!< Vertex weights in the search order, or \c NULL in the unweighted search.
+	double 		wbest; 			//!< Weight of the best clique found.
+	double 		tol; 			//!< A clique improves on the best one only if it is heavier by more than this tolerance.
+	struct CliqueShared * sh; 	//!< Data shared by the tasks of a parallel search, or \c NULL in a sequential search.
+	struct CliqueSearch * next; 	//!< Next free search state in the pool of a parallel search.
+} CliqueSearch;
+
+/*!
+ * \struct CliqueShared
+ * \brief Data shared by the tasks of a parallel search for a maximum clique.
+ *
+ * Each task runs on a search state taken from a pool, which grows only when all the states are in use, so that the
+ * number of states is bounded by the number of tasks that may be running or suspended at the same time.
+ */
+typedef struct CliqueShared {
+	Graph * 	g; 				//!< Graph renumbered in the search order.
+	int 		szbest; 		//!< Size of the best clique found by all the tasks, accessed atomically.
+	int * 		best; 			//!< Best clique found by all the tasks.
+	int 		split; 			//!< The branches of the levels less than this one are always run as tasks.
+	int 		threads; 		//!< Number of threads.
+	int 		queued; 		//!< Number of tasks created and not yet started, accessed atomically.
+	CliqueSearch * pool; 	//!< Free search states.
+} CliqueShared;
+
+/*
+ * Greedy sequential coloring of the candidate set p in the order of the vertices. Color classes are built one at a time:
+ * the smallest uncolored vertex is taken, and its neighbors are removed from the vertices that can still receive the current color.
+ * Only the vertices with color at least kmin are recorded, since the others cannot lead to a larger clique.
+ */
+static int colorSort(CliqueSearch * cs, BitMap * p, int kmin, int * order, int * color) {
+	BitMap row;
+	Node node;
+	int v, k, cnt = 0;
+
+	setAsViewOf(cs->g->matrix, &row);
+	copyAll(cs->U, p);
+	for (k = 1; isNotEmpty(cs->U); k++) {
+		copyAll(cs->Q, cs->U);
+		for (begin(cs->Q, &node); !end(&node); next(&node)) {
+			v = getElement(&node);
+			delElement(cs->U, v);
+			subMap(cs->g->matrix, &row, v);
+			removeAll(cs->Q, &row);
+			if (k >= kmin) {
+				order[cnt] = v;
+				color[cnt++] = k;
+			}
+		}
+	}
+
+	return cnt;
+}
+
+static void expand(CliqueSearch * cs, int d) {
+	const int n = cs->g->n;
+	BitMap p, np, row;
+	int t, v, cnt;
+
+	if (cs->order[d] == NULL) {
+		cs->order[d] = (int *) malloc(n * sizeof(int));
+		cs->color[d] = (int *) malloc(n * sizeof(int));
+	}
+
+	setAsViewOf(cs->P, &p);
+	setAsViewOf(cs->P, &np);
+	setAsViewOf(cs->g->matrix, &row);
+	subMap(cs->P, &p, d);
+	subMap(cs->P, &np, d + 1);
+
+	cnt = colorSort(cs, &p, cs->szbest - d + 1, cs->order[d], cs->color[d]);
+	for (t = cnt - 1; t >= 0 && d + cs->color[d][t] > cs->szbest; t--) {
+		v = cs->order[d][t];
+		cs->C[d] = v;
+		subMap(cs->g->matrix, &row, v);
+		intersectOf(&np, &p, &row);
+		if (isNotEmpty(&np))
+			expand(cs, d + 1);
+		else if (d + 1 > cs->szbest) {
+			cs->szbest = d + 1;
+			memcpy(cs->best, cs->C, cs->szbest * sizeof(int));
+		}
+		delElement(&p, v);
+	}
+}
+
+/*
+ * Weighted version of colorSort. The bound of a vertex is the sum, over its color class and the classes before it,
+ * of the maximum weight in the class. Only the vertices whose bound added to wC exceeds the best weight are recorded.
+ */
+static int wcolorSort(CliqueSearch * cs, BitMap * p, double wC, int * order, double * ub) {
+	BitMap row;
+	Node node;
+	double wmax, sum = 0.0;
+	int v, first, t, cnt = 0;
+
+	setAsViewOf(cs->g->matrix, &row);
+	copyAll(cs->U, p);
+	while (isNotEmpty(cs->U)) {
+		copyAll(cs->Q, cs->U);
+		first = cnt;
+		wmax = 0.0;
+		for (begin(cs->Q, &node); !end(&node); next(&node)) {
+			v = getElement(&node);
+			delElement(cs->U, v);
+			subMap(cs->g->matrix, &row, v);
+			removeAll(cs->Q, &row);
+			order[cnt++] = v;
+			if (cs->w[v] > wmax)
+				wmax = cs->w[v];
+		}
+		sum += wmax;
+		if (wC + sum <= cs->wbest + cs->tol)
+			cnt = first;
+		else
+			for (t = first; t < cnt; t++)
+				ub[t] = sum;
+	}
+
+	return cnt;
+}
+
+static void wexpand(CliqueSearch * cs, int d, double wC) {
+	const int n = cs->g->n;
+	BitMap p, np, row;
+	int t, v, cnt;
+
+	if (cs->order[d] == NULL) {
+		cs->order[d] = (int *) malloc(n * sizeof(int));
+		cs->ub[d] = (double *) malloc(n * sizeof(double));
+	}
+
+	setAsViewOf(cs->P, &p);
+	setAsViewOf(cs->P, &np);
+	setAsViewOf(cs->g->matrix, &row);
+	subMap(cs->P, &p, d);
+	subMap(cs->P, &np, d + 1);
+
+	if (wC + sumOf(&p, cs->w) <= cs->wbest + cs->tol)
+		return;
+
+	cnt = wcolorSort(cs, &p, wC, cs->order[d], cs->ub[d]);
+	for (t = cnt - 1; t >= 0 && wC + cs->ub[d][t] > cs->wbest + cs->tol; t--) {
+		v = cs->order[d][t];
+		cs->C[d] = v;
+		subMap(cs->g->matrix, &row, v);
+		intersectOf(&np, &p, &row);
+		if (isNotEmpty(&np))
+			wexpand(cs, d + 1, wC + cs->w[v]);
+		else if (wC + cs->w[v] > cs->wbest + cs->tol) {
+			cs->wbest = wC + cs->w[v];
+			cs->szbest = d + 1;
+			memcpy(cs->best, cs->C, cs->szbest * sizeof(int));
+		}
+		delElement(&p, v);
+	}
+}
+
+/*
+ * Allocates the scratch bitmaps and arrays of a search on the graph g, which is already in the search order.
+ */
+static void newScratch(CliqueSearch * cs, Graph * g) {
+	const int n = g->n;
+
+	cs->g = g;
+	cs->P = newBitMapVector(n + 1, n);
+	cs->U = newBitMap(n);
+	cs->Q = newBitMap(n);
+	cs->order = (int **) calloc(n + 1, sizeof(int *));
+	cs->color = (int **) calloc(n + 1, sizeof(int *));
+	cs->ub = (double **) calloc(n + 1, sizeof(double *));
+	cs->C = (int *) malloc(n * sizeof(int));
+	cs->best = (int *) malloc(n * sizeof(int));
+	cs->szbest = 0;
+	cs->w = NULL;
+	cs->wbest = 0.0;
+	cs->tol = 0.0;
+	cs->sh = NULL;
+	cs->next = NULL;
+}
+
+static void delScratch(CliqueSearch * cs) {
+	int i;
+
+	for (i = 0; i <= cs->g->n; i++) {
+		free(cs->order[i]);
+		free(cs->color[i]);
+		free(cs->ub[i]);
+	}
+	free(cs->order);
+	free(cs->color);
+	free(cs->ub);
+	free(cs->C);
+	free(cs->best);
+	free(cs->w);
+	freeBitMap(cs->P);
+	freeBitMap(cs->U);
+	freeBitMap(cs->Q);
+}
+
+/*
+ * Renumbers gg in a minimum width order (see #newDegeneracyRenumbered). Rinv[i] is the original vertex of position i in the search order.
+ */
+static Graph * newSearchGraph(Graph * gg, int * Rinv) {
+	const int n = gg->n;
+	int * R = (int *) malloc(n * sizeof(int));
+	Graph * g;
+	int i;
+
+	g = newDegeneracyRenumbered(gg, R);
+	for (i = 0; i < n; i++)
+		Rinv[R[i]] = i;
+
+	free(R);
+	return g;
+}
+
+/*
+ * Creates the state of a search on gg renumbered in a minimum width order, whose candidate set of level 0 is the whole vertex set.
+ */
+static void newSearch(CliqueSearch * cs, Graph * gg, int * Rinv) {
+	BitMap p;
+
+	newScratch(cs, newSearchGraph(gg, Rinv));
+	setAsViewOf(cs->P, &p);
+	subMap(cs->P, &p, 0);
+	addAllElements(&p);
+}
+
+static void delSearch(CliqueSearch * cs) {
+	delScratch(cs);
+	delGraph(cs->g);
+	free(cs->g);
+}
+
+/*
+ * Same search as expand, for graphs with at most N vertices, on the fixed size sets of smallgraph.h. The candidate
+ * set of level d is P[d], and the sets of the coloring are local variables. The search state is allocated once, since
+ * order and color take 2 (N+1) N integers.
+ */
+#define SMALLCLIQUE_DEFINE(N) \
+\
+typedef struct { \
+	SmallSet##N 	P[N + 1]; \
+	SmallGraph##N * g; \
+	int 			order[N + 1][N]; \
+	int 			color[N + 1][N]; \
+	int 			C[N]; \
+	int * 			best; \
+	int 			szbest; \
+} SmallCliqueSearch##N; \
+\
+static int smallColorSort##N(SmallCliqueSearch##N * cs, SmallSet##N const * p, int kmin, int * order, int * color) { \
+	SmallSet##N U = *p, Q; \
+	int v, k, cnt = 0; \
+\
+	for (k = 1; !smallIsEmpty##N(&U); k++) { \
+		Q = U; \
+		for (v = smallFirst##N(&Q); v >= 0; v = smallNext##N(&Q, v)) { \
+			smallDel##N(&U, v); \
+			smallAndNot##N(&Q, &Q, smallNeig##N(cs->g, v)); \
+			if (k >= kmin) { \
+				order[cnt] = v; \
+				color[cnt++] = k; \
+			} \
+		} \
+	} \
+\
+	return cnt; \
+} \
+\
+static void smallExpand##N(SmallCliqueSearch##N * cs, int d) { \
+	SmallSet##N * p = &cs->P[d]; \
+	int t, v, cnt; \
+\
+	cnt = smallColorSort##N(cs, p, cs->szbest - d + 1, cs->order[d], cs->color[d]); \
+	for (t = cnt - 1; t >= 0 && d + cs->color[d][t] > cs->szbest; t--) { \
+		v = cs->order[d][t]; \
+		cs->C[d] = v; \
+		smallAnd##N(&cs->P[d + 1], p, smallNeig##N(cs->g, v)); \
+		if (!smallIsEmpty##N(&cs->P[d + 1])) \
+			smallExpand##N(cs, d + 1); \
+		else if (d + 1 > cs->szbest) { \
+			cs->szbest = d + 1; \
+			memcpy(cs->best, cs->C, cs->szbest * sizeof(int)); \
+		} \
+		smallDel##N(p, v); \
+	} \
+} \
+\
+static int smallMaxClique##N(Graph * g, int * best) { \
+	SmallCliqueSearch##N * cs = (SmallCliqueSearch##N *) memalign(sizeof(SmallSet##N), sizeof(SmallCliqueSearch##N)); \
+	int sz; \
+\
+	cs->g = newSmallGraph##N(g); \
+	cs->best = best; \
+	cs->szbest = 0; \
+	smallFill##N(&cs->P[0], g->n); \
+	smallExpand##N(cs, 0); \
+	sz = cs->szbest; \
+\
+	delSmallGraph##N(cs->g); \
+	free(cs); \
+	return sz; \
+}
+
+SMALLCLIQUE_DEFINE(64)
+SMALLCLIQUE_DEFINE(128)
+SMALLCLIQUE_DEFINE(256)
+
+BitMap * maxClique(Graph * gg) {
+	const int n = gg->n;
+	BitMap * ret = newBitMap(n);
+	int * Rinv;
+	int * best;
+	CliqueSearch cs;
+	Graph * g;
+	BitMap p;
+	int i, sz;
+
+	gg->maxcq = 0;
+	if (n == 0)
+		return ret;
+
+	Rinv = (int *) malloc(n * sizeof(int));
+	best = (int *) malloc(n * sizeof(int));
+	g = newSearchGraph(gg, Rinv);
+
+	// the graphs with at most 256 vertices are searched on the fixed size sets of smallgraph.h
+	switch (smallGraphSize(n)) {
+	case 64:
+		sz = smallMaxClique64(g, best);
+		break;
+	case 128:
+		sz = smallMaxClique128(g, best);
+		break;
+	case 256:
+		sz = smallMaxClique256(g, best);
+		break;
+	default:
+		newScratch(&cs, g);
+		setAsViewOf(cs.P, &p);
+		subMap(cs.P, &p, 0);
+		addAllElements(&p);
+		expand(&cs, 0);
+		sz = cs.szbest;
+		memcpy(best, cs.best, sz * sizeof(int));
+		delScratch(&cs);
+	}
+
+	for (i = 0; i < sz; i++)
+		addElement(ret, Rinv[best[i]]);
+	gg->maxcq = sz;
+
+	delGraph(g);
+	free(g);
+	free(best);
+	free(Rinv);
+
+	return ret;
+}
+
+static CliqueSearch * acquireSearch(CliqueShared * sh) {
+	CliqueSearch * cs;
+
+#pragma omp critical (cliquePool)
+	{
+		cs = sh->pool;
+		if (cs != NULL)
+			sh->pool = cs->next;
+	}
+	if (cs == NULL) {
+		cs = (CliqueSearch *) malloc(sizeof(CliqueSearch));
+		newScratch(cs, sh->g);
+		cs->sh = sh;
+	}
+
+	return cs;
+}
+
+static void releaseSearch(CliqueShared * sh, CliqueSearch * cs) {
+#pragma omp critical (cliquePool)
+	{
+		cs->next = sh->pool;
+		sh->pool = cs;
+	}
+}
+
+static void publish(CliqueShared * sh, int const * C, int sz) {
+#pragma omp critical (cliqueBest)
+	if (sz > sh->szbest) {
+		memcpy(sh->best, C, sz * sizeof(int));
+		__atomic_store_n(&sh->szbest, sz, __ATOMIC_RELAXED);
+	}
+}
+
+/*
+ * Parallel version of expand. The bounds are checked against the best clique found by all the tasks. At the levels less
+ * than sh->split, and at any level while fewer tasks than threads wait to start, each branch is run as a task on its own
+ * search state, where the current clique and the candidate set of the next level are copied. The deeper subtrees are
+ * thus split again when the threads are about to run out of work.
+ */
+static void pexpand(CliqueSearch * cs, int d) {
+	CliqueShared * sh = cs->sh;
+	const int n = cs->g->n;
+	CliqueSearch * ts;
+	BitMap p, np, row;
+	int t, v, cnt;
+
+	if (cs->order[d] == NULL) {
+		cs->order[d] = (int *) malloc(n * sizeof(int));
+		cs->color[d] = (int *) malloc(n * sizeof(int));
+	}
+
+	setAsViewOf(cs->P, &p);
+	setAsViewOf(cs->g->matrix, &row);
+	subMap(cs->P, &p, d);
+
+	cnt = colorSort(cs, &p, __atomic_load_n(&sh->szbest, __ATOMIC_RELAXED) - d + 1, cs->order[d], cs->color[d]);
+	for (t = cnt - 1; t >= 0 && d + cs->color[d][t] > __atomic_load_n(&sh->szbest, __ATOMIC_RELAXED); t--) {
+		v = cs->order[d][t];
+		cs->C[d] = v;
+		subMap(cs->g->matrix, &row, v);
+		if (d < sh->split || __atomic_load_n(&sh->queued, __ATOMIC_RELAXED) < sh->threads) {
+			ts = acquireSearch(sh);
+			setAsViewOf(ts->P, &np);
+			subMap(ts->P, &np, d + 1);
+			intersectOf(&np, &p, &row);
+			if (isEmpty(&np)) {
+				publish(sh, cs->C, d + 1);
+				releaseSearch(sh, ts);
+			}
+			else {
+				memcpy(ts->C, cs->C, (d + 1) * sizeof(int));
+				__atomic_add_fetch(&sh->queued, 1, __ATOMIC_RELAXED);
+#pragma omp task firstprivate(ts, d)
+				{
+					__atomic_sub_fetch(&ts->sh->queued, 1, __ATOMIC_RELAXED);
+					pexpand(ts, d + 1);
+					releaseSearch(ts->sh, ts);
+				}
+			}
+		}
+		else {
+			setAsViewOf(cs->P, &np);
+			subMap(cs->P, &np, d + 1);
+			intersectOf(&np, &p, &row);
+			if (isEmpty(&np))
+				publish(sh, cs->C, d + 1);
+			else
+				pexpand(cs, d + 1);
+		}
+		delElement(&p, v);
+	}
+}
+
+BitMap * maxCliqueParallel(Graph * gg, int threads) {
+	const int n = gg->n;
+	BitMap * ret = newBitMap(n);
+	int * Rinv;
+	CliqueShared sh;
+	CliqueSearch * cs;
+	BitMap p;
+	int i;
+
+	gg->maxcq = 0;
+	if (n == 0)
+		return ret;
+
+#ifdef _OPENMP
+	if (threads <= 0)
+		threads = omp_get_max_threads();
+#else
+	threads = 1;
+#endif
+
+	Rinv = (int *) malloc(n * sizeof(int));
+	sh.g = newSearchGraph(gg, Rinv);
+	sh.szbest = 0;
+	sh.best = (int *) malloc(n * sizeof(int));
+	sh.split = threads > 1 ? 2 : 0;
+	sh.threads = threads > 1 ? threads : 0;
+	sh.queued = 0;
+	sh.pool = NULL;
+
+	cs = acquireSearch(&sh);
+	setAsViewOf(cs->P, &p);
+	subMap(cs->P, &p, 0);
+	addAllElements(&p);
+
+#pragma omp parallel num_threads(threads)
+#pragma omp single
+	pexpand(cs, 0);
+
+	for (i = 0; i < sh.szbest; i++)
+		addElement(ret, Rinv[sh.best[i]]);
+	gg->maxcq = sh.szbest;
+
+	releaseSearch(&sh, cs);
+	while (sh.pool != NULL) {
+		cs = sh.pool;
+		sh.pool = cs->next;
+		delScratch(cs);
+		free(cs);
+	}
+	delGraph(sh.g);
+	free(sh.g);
+	free(sh.best);
+	free(Rinv);
+
+	return ret;
+}
+
+/*
+ * Common part of the weighted solvers. Vertices of non-positive weight never improve a clique, so they are removed
+ * from the candidate set of level 0 and never reach the clique found.
+ */
+static BitMap * maxWeightCliqueTol(Graph * gg, double const * w, double tol) {
+	const int n = gg->n;
+	BitMap * ret = newBitMap(n);
+	int * Rinv;
+	CliqueSearch cs;
+	BitMap p;
+	int i;
+
+	gg->maxwcq = 0.0;
+	if (n == 0)
+		return ret;
+
+	Rinv = (int *) malloc(n * sizeof(int));
+	newSearch(&cs, gg, Rinv);
+	cs.w = (double *) malloc(n * sizeof(double));
+	setAsViewOf(cs.P, &p);
+	subMap(cs.P, &p, 0);
+	for (i = 0; i < n; i++)
+		if ((cs.w[i] = w[Rinv[i]]) <= 0.0)
+			delElement(&p, i);
+	cs.tol = tol;
+	wexpand(&cs, 0, 0.0);
+
+	for (i = 0; i < cs.szbest; i++)
+		addElement(ret, Rinv[cs.best[i]]);
+	gg->maxwcq = cs.wbest;
+
+	delSearch(&cs);
+	free(Rinv);
+
+	return ret;
+}
+
+BitMap * maxWeightClique(Graph * g, double const * w) {
+	return maxWeightCliqueTol(g, w, 0.0);
+}
+
+BitMap * maxIntWeightClique(Graph * g, double const * w) {
+	return maxWeightCliqueTol(g, w, 0.5);
+}
+
+int isClique(Graph * g, BitMap const * s, int * missing) {
+	MAPWORD const * sw = (MAPWORD const *) s->R;
+	MAPWORD const * rw;
+	const int mn = s->nRnodes << (LOGB - LOGMAPWORD);
+	const int step = g->matrix->step;
+	unsigned long long x, y;
+	int lo, hi, k, t, v;
+
+	for (lo = 0; lo < mn && sw[lo] == 0; lo++);
+	for (hi = mn - 1; hi >= lo && sw[hi] == 0; hi--);
+
+	for (k = lo; k <= hi; k++)
+		for (x = sw[k]; x; x &= x - 1) {
+			v = (k << LOGMAPWORD) + __builtin_ctzll(x);
+			rw = (MAPWORD const *) (g->matrix->R + (v << step));
+			for (t = lo; t <= hi; t++) {
+				y = (MAPWORD) (sw[t] & ~rw[t]);
+				if (t == k)
+					y &= ~(1ULL << (v & ((1 << LOGMAPWORD) - 1)));
+				if (y) {
+					if (missing != NULL) {
+						missing[0] = v;
+						missing[1] = (t << LOGMAPWORD) + __builtin_ctzll(y);
+					}
+					return 0;
+				}
+			}
+		}
+
+	if (missing != NULL)
+		missing[0] = missing[1] = -1;
+	return 1;
+}
+
+/*
+ * Common part of verifyCliques and verifyCliqueRows: set i is s[i] if s is not NULL, and row i of rows otherwise.
+ */
+static int verifyBatch(Graph * g, BitMap * const * s, BitMap * rows, int k, BitMap * ok, int * missing, int threads) {
+	char * res = (char *) malloc(k > 0 ? k : 1);
+	int i, cnt = 0;
+
+#ifdef _OPENMP
+	if (threads <= 0)
+		threads = omp_get_max_threads();
+#else
+	threads = 1;
+#endif
+
+#pragma omp parallel num_threads(threads)
+	{
+		BitMap row;
+
+		if (rows != NULL)
+			setAsViewOf(rows, &row);
+#pragma omp for schedule(dynamic, 16) reduction(+:cnt)
+		for (i = 0; i < k; i++) {
+			if (rows != NULL)
+				subMap(rows, &row, i);
+			res[i] = isClique(g, rows != NULL ? &row : s[i], missing != NULL ? missing + 2 * i : NULL);
+			cnt += res[i];
+		}
+	}
+
+	// bits of the result are set sequentially, since the threads would share the words of ok
+	if (ok != NULL) {
+		delAllElements(ok);
+		for (i = 0; i < k; i++)
+			if (res[i])
+				addElement(ok, i);
+	}
+	free(res);
+
+	return cnt;
+}
+
+int verifyCliques(Graph * g, BitMap * const * s, int k, BitMap * ok, int * missing, int threads) {
+	return verifyBatch(g, s, NULL, k, ok, missing, threads);
+}
+
+int verifyCliqueRows(Graph * g, BitMap * s, BitMap * ok, int * missing, int threads) {
+	return verifyBatch(g, NULL, s, s->size, ok, missing, threads);
+}
@@ -0,0 +1,140 @@
+/*!
+ * \file clique.h
+ *
+ * \date Oct 18, 2026
+ * \author Ricardo C. Corrêa (correa@ufrrj.br)
+ *
+ * \brief Exact maximum clique and maximum weight clique algorithms on the bitmap implementation of graphs.
+ *
+ * The search is a bit-parallel branch-and-bound in the style of BBMC (San Segundo et al.): the candidate set of each
+ * node of the search tree is a #BitMap, and the upper bound is given by a greedy coloring of the candidate set, whose
+ * color classes are built with bitmap operations on the rows of the adjacency matrix. The graph is renumbered
+ * beforehand in a minimum width order, so that the coloring and the branching follow the natural order of the bitmaps.
+ *
+ * Candidate cliques (from heuristics, for instance) are verified one at a time by #isClique, or in batches on
+ * multiple threads by #verifyCliques and #verifyCliqueRows.
+ */
+#ifndef CLIQUE_H_
+#define CLIQUE_H_
+
+#include <graph.h>
+
+/*!
+ * \fn BitMap * maxClique(Graph * g)
+ * \brief Computes a maximum clique of a specified graph.
+ *
+ * Graphs with at most 256 vertices are searched on the fixed size sets of smallgraph.h.
+ * The size of the clique found is also stored in \c g->maxcq.
+ *
+ * \param g The graph.
+ *
+ * \return A new bitmap with the vertices of a maximum clique of \c g.
+ */
+BitMap * maxClique(Graph * g);
+
+/*!
+ * \fn BitMap * maxCliqueParallel(Graph * g, int threads)
+ * \brief Computes a maximum clique of a specified graph with multiple threads.
+ *
+ * The search is the same as in #maxClique, but the branches of the first two levels of the search tree are run as
+ * OpenMP tasks, which are dynamically distributed to the threads. Since a few of these subtrees usually hold most of
+ * the search, the branches of any deeper level are also run as tasks whenever fewer tasks than threads wait to start,
+ * so that the threads that run out of work take parts of the subtrees still being searched. The size of the best
+ * clique found is shared by all the tasks, so that each of them prunes with the global incumbent. Each task runs on
+ * scratch bitmaps taken from a pool, so no allocation happens during the search once the pool has grown to the number
+ * of concurrent tasks. Without OpenMP (\c -fopenmp not in the \c gcc command line), the search is sequential.
+ *
+ * The size of the clique found is also stored in \c g->maxcq.
+ *
+ * \param g The graph.
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ *
+ * \return A new bitmap with the vertices of a maximum clique of \c g.
+ */
+BitMap * maxCliqueParallel(Graph * g, int threads);
+
+/*!
+ * \fn BitMap * maxWeightClique(Graph * g, double const * w)
+ * \brief Computes a maximum weight clique of a specified graph with real vertex weights.
+ *
+ * The upper bound of the search is a weighted coloring bound: the candidate set is greedily colored, and the bound
+ * of a vertex is the sum of the maximum weights of its color class and of the classes before it. Every node of the
+ * search tree is also pruned by the total weight of the candidate set, computed with #sumOf. Vertices of non-positive
+ * weight are left out of the search, so they are never in the clique found. The weight of the clique found is also
+ * stored in \c g->maxwcq.
+ *
+ * \param g The graph.
+ * \param w The vertex weights, as returned by #readDoubleWeights.
+ *
+ * \return A new bitmap with the vertices of a maximum weight clique of \c g.
+ */
+BitMap * maxWeightClique(Graph * g, double const * w);
+
+/*!
+ * \fn BitMap * maxIntWeightClique(Graph * g, double const * w)
+ * \brief Computes a maximum weight clique of a specified graph with integer vertex weights.
+ *
+ * Same as #maxWeightClique, except that all the weights are assumed to be integers, so that a clique improves on the
+ * best one found only if it is heavier by at least one unit. The bounds are thus insensitive to the rounding of the
+ * sums.
+ *
+ * \param g The graph.
+ * \param w The vertex weights, as returned by #readIntWeights.
+ *
+ * \return A new bitmap with the vertices of a maximum weight clique of \c g.
+ */
+BitMap * maxIntWeightClique(Graph * g, double const * w);
+
+/*!
+ * \fn int isClique(Graph * g, BitMap const * s, int * missing)
+ * \brief Determines whether a specified set of vertices is a clique of a graph.
+ *
+ * For each vertex \c v of \c s, in increasing order, the words of \f$s \setminus N(v)\f$ are scanned, and the
+ * scan stops at the first word with a vertex other than \c v. Only the words between the first and the last nonempty
+ * words of \c s are scanned. Nothing is allocated.
+ *
+ * \param g The graph.
+ * \param s The set of vertices.
+ * \param missing Array of size 2 where a pair of nonadjacent vertices of \c s is stored if \c s is not a clique
+ * (the smallest vertex of \c s with a non-neighbor in \c s, followed by its smallest non-neighbor in \c s), or \c NULL.
+ *
+ * \return A nonzero value if \c s is a clique of \c g, and 0 otherwise.
+ */
+int isClique(Graph * g, BitMap const * s, int * missing);
+
+/*!
+ * \fn int verifyCliques(Graph * g, BitMap * const * s, int k, BitMap * ok, int * missing, int threads)
+ * \brief Determines which ones of specified sets of vertices are cliques of a graph.
+ *
+ * Each set is verified by #isClique, and the sets are distributed to the threads with OpenMP.
+ *
+ * \param g The graph.
+ * \param s Array of \c k sets of vertices.
+ * \param k The number of sets.
+ * \param ok Bitmap of size at least \c k where \c i is stored if \c s[i] is a clique, or \c NULL (the other elements
+ * are removed).
+ * \param missing Array of size 2 x \c k where the pair of nonadjacent vertices of \c s[i] found by #isClique is stored
+ * in \c missing[2*i] and \c missing[2*i+1] (-1 and -1 if \c s[i] is a clique), or \c NULL.
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ *
+ * \return The number of cliques among the sets.
+ */
+int verifyCliques(Graph * g, BitMap * const * s, int k, BitMap * ok, int * missing, int threads);
+
+/*!
+ * \fn int verifyCliqueRows(Graph * g, BitMap * s, BitMap * ok, int * missing, int threads)
+ * \brief Determines which ones of the rows of a bitmap vector are cliques of a graph.
+ *
+ * Same as #verifyCliques, for the sets packed as the rows of a bitmap vector created by #newBitMapVector.
+ *
+ * \param g The graph.
+ * \param s Bitmap vector with \c k rows of size \c n.
+ * \param ok Bitmap of size at least \c k where \c i is stored if row \c i of \c s is a clique, or \c NULL.
+ * \param missing Array of size 2 x \c k, as in #verifyCliques, or \c NULL.
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ *
+ * \return The number of cliques among the rows.
+ */
+int verifyCliqueRows(Graph * g, BitMap * s, BitMap * ok, int * missing, int threads);
+
+#endif /* CLIQUE_H_ */
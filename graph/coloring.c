@@ -0,0 +1,198 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <heap.h>
+#include <coloring.h>
+#include <smallgraph.h>
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/*
+ * Builds the color classes from the colors of the vertices.
+ */
+static Coloring * newColoring(int n, int k, int * color, double start) {
+	Coloring * c = (Coloring *) malloc(sizeof(Coloring));
+	int i;
+
+	c->k = k;
+	c->color = color;
+	c->classes = newBitMapVector(k > 0 ? k : 1, n > 0 ? n : 1);
+	setAsViewOf(c->classes, &c->cls);
+	for (i = 0; i < n; i++) {
+		subMap(c->classes, &c->cls, color[i]);
+		addElement(&c->cls, i);
+	}
+	c->time = now() - start;
+
+	return c;
+}
+
+/*
+ * Same coloring as greedyColoring, for graphs with at most N vertices, on the fixed size sets of smallgraph.h.
+ * Returns the number of colors.
+ */
+#define SMALLCOLORING_DEFINE(N) \
+static int smallGreedyColoring##N(Graph * g, int * color) { \
+	SmallGraph##N * sg = newSmallGraph##N(g); \
+	SmallSet##N U, Q; \
+	int v, k; \
+\
+	smallFill##N(&U, g->n); \
+	for (k = 0; !smallIsEmpty##N(&U); k++) { \
+		Q = U; \
+		for (v = smallFirst##N(&Q); v >= 0; v = smallNext##N(&Q, v)) { \
+			color[v] = k; \
+			smallDel##N(&U, v); \
+			smallAndNot##N(&Q, &Q, smallNeig##N(sg, v)); \
+		} \
+	} \
+\
+	delSmallGraph##N(sg); \
+	return k; \
+}
+
+SMALLCOLORING_DEFINE(64)
+SMALLCOLORING_DEFINE(128)
+SMALLCOLORING_DEFINE(256)
+
+Coloring * greedyColoring(Graph * g) {
+	const double start = now();
+	const int n = g->n;
+	int * color = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	BitMap * U;
+	BitMap * Q;
+	BitMap row;
+	Node node;
+	int v, k = 0;
+
+	// the graphs with at most 256 vertices are colored on the fixed size sets of smallgraph.h
+	switch (n > 0 ? smallGraphSize(n) : 0) {
+	case 64:
+		return newColoring(n, smallGreedyColoring64(g, color), color, start);
+	case 128:
+		return newColoring(n, smallGreedyColoring128(g, color), color, start);
+	case 256:
+		return newColoring(n, smallGreedyColoring256(g, color), color, start);
+	}
+
+	U = newBitMap(n > 0 ? n : 1);
+	Q = newBitMap(n > 0 ? n : 1);
+	setAsViewOf(g->matrix, &row);
+	if (n > 0)
+		addAllElements(U);
+	for (; isNotEmpty(U); k++) {
+		copyAll(Q, U);
+		for (begin(Q, &node); !end(&node); next(&node)) {
+			v = getElement(&node);
+			color[v] = k;
+			delElement(U, v);
+			subMap(g->matrix, &row, v);
+			removeAll(Q, &row);
+		}
+	}
+
+	freeBitMap(U);
+	freeBitMap(Q);
+
+	return newColoring(n, k, color, start);
+}
+
+/*
+ * Saturation and degree arrays of the running DSATUR, seen by the comparison function of the heap. They are thread-local
+ * instead of captured by a nested function, which would require an executable stack for its trampoline.
+ */
+static __thread int * dsatSat;
+static __thread int * dsatDeg;
+
+static int compar(const void * x, const void * y) {
+	const int ix = *((const int *) x);
+	const int iy = *((const int *) y);
+	return dsatSat[iy] != dsatSat[ix] ? dsatSat[iy] - dsatSat[ix] : dsatDeg[iy] - dsatDeg[ix];
+}
+
+static int hash(const void * x) {
+	return *((const int *) x);
+}
+
+Coloring * dsaturColoring(Graph * g) {
+	const double start = now();
+	const int n = g->n;
+	int * color = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	int * sat = (int *) calloc(n > 0 ? n : 1, sizeof(int));
+	int * deg = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	int * heap = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	int * pos = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	BitMap * U = newBitMap(n > 0 ? n : 1);
+	BitMap * S = newBitMap(n > 0 ? n : 1);
+	BitMap * adj;
+	BitMap row, a;
+	Node node;
+	int i, u, v, c, nh, maxdeg = 0, k = 0;
+
+	dsatSat = sat;
+	dsatDeg = deg;
+	setAsViewOf(g->matrix, &row);
+	for (i = 0; i < n; i++) {
+		subMap(g->matrix, &row, i);
+		deg[i] = cardOf(&row);
+		if (deg[i] > maxdeg)
+			maxdeg = deg[i];
+		heap[i] = i;
+		pos[i] = i;
+	}
+	if (n > 0)
+		addAllElements(U);
+
+	// row c of adj is the set of vertices adjacent to some vertex of color c
+	adj = newBitMapVector(maxdeg + 1, n > 0 ? n : 1);
+	setAsViewOf(adj, &a);
+
+	heapify_a(heap, n, sizeof(int), compar, pos, hash);
+	for (nh = n; nh > 0; nh--) {
+		v = heap[0];
+		heappoll_a(heap, nh, sizeof(int), compar, pos, hash);
+		delElement(U, v);
+
+		for (c = 0; c < k; c++) {
+			subMap(adj, &a, c);
+			if (!hasElement(&a, v))
+				break;
+		}
+		if (c == k)
+			k++;
+		color[v] = c;
+
+		// the uncolored neighbors of v not yet adjacent to color c have their saturation increased
+		subMap(adj, &a, c);
+		subMap(g->matrix, &row, v);
+		intersectOf(S, &row, U);
+		removeAll(S, &a);
+		addAll(&a, &row);
+		for (begin(S, &node); !end(&node); next(&node)) {
+			u = getElement(&node);
+			sat[u]++;
+			heapup_a(heap, pos[u], sizeof(int), compar, pos, hash);
+		}
+	}
+
+	freeBitMap(U);
+	freeBitMap(S);
+	freeBitMap(adj);
+	free(sat);
+	free(deg);
+	free(heap);
+	free(pos);
+
+	return newColoring(n, k, color, start);
+}
+
+void delColoring(Coloring * c) {
+	freeBitMap(c->classes);
+	free(c->color);
+	free(c);
+}
@@ -0,0 +1,76 @@
+/*!
+ * \file coloring.h
+ *
+ * \date Oct 18, 2026
+ * \author Ricardo C. Corrêa (correa@ufrrj.br)
+ *
+ * \brief Vertex coloring heuristics on the bitmap implementation of graphs.
+ *
+ * Two heuristics are provided:
+ *
+ * - #greedyColoring: bit-parallel sequential greedy coloring, in which the color classes are built one at a time
+ *   by repeatedly removing the neighborhood of the chosen vertex from a bitmap of the vertices that can still receive
+ *   the current color;
+ * - #dsaturColoring: DSATUR (Brélaz), in which the next vertex to color is the one with the largest number of distinct
+ *   colors in its neighborhood (ties broken by the largest degree), kept in the indexed heap of heap.h.
+ *
+ * Both return a #Coloring, with the color classes as bitmaps.
+ */
+#ifndef COLORING_H_
+#define COLORING_H_
+
+#include <graph.h>
+
+/*!
+ * \struct Coloring
+ * \brief A coloring of the vertices of a graph.
+ */
+typedef struct {
+	int 		k; 				//!< Number of colors used.
+	int * 		color; 			//!< Color of each vertex, in { 0, ..., \c k - 1 }.
+	BitMap * 	classes; 		//!< Bitmap vector whose row \c c is the set of vertices of color \c c.
+	BitMap 		cls; 			//!< Returned as color class by #colorClass.
+	double 		time; 			//!< Time spent to compute the coloring, in seconds.
+} Coloring;
+
+/*!
+ * \fn Coloring * greedyColoring(Graph * g)
+ * \brief Colors the vertices of a specified graph in the sequential greedy way.
+ *
+ * The vertices are taken in increasing order. Each color class is a maximal independent set of the vertices not yet colored.
+ * Graphs with at most 256 vertices are colored on the fixed size sets of smallgraph.h.
+ *
+ * \param g The graph.
+ *
+ * \return A new coloring of \c g.
+ */
+Coloring * greedyColoring(Graph * g);
+
+/*!
+ * \fn Coloring * dsaturColoring(Graph * g)
+ * \brief Colors the vertices of a specified graph with the DSATUR heuristic.
+ *
+ * The saturation degrees are maintained with one bitmap per color, containing the vertices adjacent to that color,
+ * so that coloring a vertex updates the saturation of all its neighbors with a single bitmap difference.
+ *
+ * \param g The graph.
+ *
+ * \return A new coloring of \c g.
+ */
+Coloring * dsaturColoring(Graph * g);
+
+/*!
+ * \fn void delColoring(Coloring * c)
+ * \brief Deletes a specified coloring.
+ *
+ * \param c The coloring.
+ */
+void delColoring(Coloring * c);
+
+//!< Returns the set of vertices of color \c i in coloring \c c. The returned bitmap is shared by all the calls.
+static inline BitMap * colorClass(Coloring * c, int i) {
+	subMap(c->classes, &c->cls, i);
+	return &c->cls;
+}
+
+#endif /* COLORING_H_ */
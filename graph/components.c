@@ -0,0 +1,241 @@
+#include <stdio.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <components.h>
+
+#define SAMPLEROWS 64 		//!< Number of rows from which the density is estimated.
+
+static int numThreads(int threads) {
+#ifdef _OPENMP
+	return threads > 0 ? threads : omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+
+/*
+ * Builds the component bitmaps from the components of the vertices.
+ */
+static Components * newComponents(int n, int k, int * id) {
+	Components * c = (Components *) malloc(sizeof(Components));
+	int i;
+
+	c->k = k;
+	c->id = id;
+	c->comps = newBitMapVector(k > 0 ? k : 1, n > 0 ? n : 1);
+	setAsViewOf(c->comps, &c->comp);
+	for (i = 0; i < n; i++)
+		if (id[i] >= 0) {
+			subMap(c->comps, &c->comp, id[i]);
+			addElement(&c->comp, i);
+		}
+
+	return c;
+}
+
+/*
+ * Peels the components of the subgraph induced by r (the whole graph if r is NULL) with breadth-first searches,
+ * storing in id the component of each vertex if id is not NULL. Returns the number of components.
+ */
+static int peel(Graph * g, BitMap const * r, int * id) {
+	const int n = g->n;
+	BitMap * remaining = newBitMap(n > 0 ? n : 1);
+	BitMap * frontier = newBitMap(n > 0 ? n : 1);
+	BitMap * nb = newBitMap(n > 0 ? n : 1);
+	BitMap * aux;
+	Node root, node;
+	int u, k = 0;
+
+	if (r == NULL) {
+		if (n > 0)
+			addAllElements(remaining);
+	}
+	else
+		copyAll(remaining, r);
+
+	// the enumeration of remaining skips the vertices removed by the searches of the previous components
+	for (begin(remaining, &root); !end(&root); next(&root), k++) {
+		u = getElement(&root);
+		delAllElements(frontier);
+		addElement(frontier, u);
+		delElement(remaining, u);
+		do {
+			if (id != NULL)
+				for (begin(frontier, &node); !end(&node); next(&node))
+					id[getElement(&node)] = k;
+			unionOfRows(g, frontier, nb);
+			retainAll(nb, remaining);
+			removeAll(remaining, nb);
+			aux = frontier;
+			frontier = nb;
+			nb = aux;
+		} while (isNotEmpty(frontier));
+	}
+
+	freeBitMap(remaining);
+	freeBitMap(frontier);
+	freeBitMap(nb);
+
+	return k;
+}
+
+Components * componentsByBFS(Graph * g, BitMap const * r) {
+	const int n = g->n;
+	int * id = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	int u;
+
+	for (u = 0; u < n; u++)
+		id[u] = -1;
+
+	return newComponents(n, peel(g, r, id), id);
+}
+
+int countComponents(Graph * g, BitMap const * r) {
+	return peel(g, r, NULL);
+}
+
+int isForest(Graph * g, BitMap const * r) {
+	const int n = g->n;
+	const int nr = r == NULL ? n : cardOf(r);
+	BitMap row;
+	Node node;
+	long long m = 0;
+	int u;
+
+	if (nr == 0)
+		return 1;
+
+	// twice the number of edges, stopping as soon as it reaches 2 nr (a forest has less than nr edges)
+	setAsViewOf(g->matrix, &row);
+	if (r == NULL)
+		for (u = 0; u < n && m < 2LL * nr; u++) {
+			subMap(g->matrix, &row, u);
+			m += cardOf(&row);
+		}
+	else
+		for (begin(r, &node); !end(&node) && m < 2LL * nr; next(&node)) {
+			subMap(g->matrix, &row, getElement(&node));
+			m += cardOfIntersection(&row, r);
+		}
+	if (m >= 2LL * nr)
+		return 0;
+
+	return m / 2 == nr - countComponents(g, r);
+}
+
+/*
+ * Root of v, halving the path on the way. Only the parents of non-roots are written, always with an ancestor.
+ */
+static inline int findRoot(int * p, int v) {
+	int q, pq;
+
+	while ((q = __atomic_load_n(p + v, __ATOMIC_RELAXED)) != v) {
+		pq = __atomic_load_n(p + q, __ATOMIC_RELAXED);
+		if (pq != q)
+			__atomic_store_n(p + v, pq, __ATOMIC_RELAXED);
+		v = pq;
+	}
+	return v;
+}
+
+/*
+ * Links the roots of a and b, the larger one to the smaller one.
+ */
+static inline void unite(int * p, int a, int b) {
+	int aux;
+
+	for (;;) {
+		a = findRoot(p, a);
+		b = findRoot(p, b);
+		if (a == b)
+			return;
+		if (a < b) {
+			aux = a;
+			a = b;
+			b = aux;
+		}
+		aux = a;
+		if (__atomic_compare_exchange_n(p + a, &aux, b, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			return;
+	}
+}
+
+Components * componentsByUnionFind(Graph * g, BitMap const * r, int threads) {
+	const int n = g->n;
+	int * id = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	int * p = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	int u, root, k = 0;
+
+	for (u = 0; u < n; u++)
+		p[u] = u;
+
+	threads = numThreads(threads);
+#pragma omp parallel for num_threads(threads) schedule(dynamic, 64)
+	for (u = 0; u < n; u++) {
+		BitMap row;
+		int v;
+
+		if (r != NULL && !hasElement(r, u))
+			continue;
+		setAsViewOf(g->matrix, &row);
+		subMap(g->matrix, &row, u);
+		MAPELEMENTS(&row, v, {
+			if (v >= u)
+				continue;
+			if (r == NULL || hasElement(r, v))
+				unite(p, u, v);
+		});
+	}
+
+	// the root of a component is its smallest vertex, which is numbered before the other ones
+	for (u = 0; u < n; u++)
+		if (r != NULL && !hasElement(r, u))
+			id[u] = -1;
+		else {
+			root = findRoot(p, u);
+			id[u] = root == u ? k++ : id[root];
+		}
+
+	free(p);
+
+	return newComponents(n, k, id);
+}
+
+Components * connectedComponents(Graph * g, BitMap const * r, int threads) {
+	const int n = g->n;
+	const int nr = r == NULL ? n : cardOf(r);
+	const int step = nr > SAMPLEROWS ? nr / SAMPLEROWS : 1;
+	BitMap row;
+	Node node;
+	long long deg = 0;
+	int i, u, samples = 0;
+
+	// every step-th vertex of the subgraph
+	setAsViewOf(g->matrix, &row);
+	if (r == NULL)
+		for (u = 0; u < n; u += step, samples++) {
+			subMap(g->matrix, &row, u);
+			deg += cardOf(&row);
+		}
+	else
+		for (i = 0, begin(r, &node); !end(&node); next(&node), i++)
+			if (i % step == 0) {
+				subMap(g->matrix, &row, getElement(&node));
+				deg += cardOfIntersection(&row, r);
+				samples++;
+			}
+
+	threads = numThreads(threads);
+	if (samples > 0 && nr > 1 && (double) deg / samples <= UF_MAXDENSITY * threads * (nr - 1))
+		return componentsByUnionFind(g, r, threads);
+	return componentsByBFS(g, r);
+}
+
+void delComponents(Components * c) {
+	freeBitMap(c->comps);
+	free(c->id);
+	free(c);
+}
@@ -0,0 +1,127 @@
+/*!
+ * \file components.h
+ *
+ * \date Oct 18, 2026
+ * \author Ricardo C. Corrêa (correa@ufrrj.br)
+ *
+ * \brief Connected components of undirected graphs, or of their subgraphs induced by sets of vertices.
+ *
+ * Two engines are provided:
+ *
+ * - #componentsByBFS: breadth-first searches, one per component, where each level is the union of the rows of the
+ *   previous one (#unionOfRows) and the vertices reached are removed from the set still to be searched with #removeAll;
+ * - #componentsByUnionFind: a union-find over the edges, with the rows distributed to the threads, where the roots are
+ *   linked with an atomic compare-and-swap, so that no lock is needed.
+ *
+ * The searches handle a whole row per vertex and are best for dense graphs, whereas the union-find adds a cost per edge,
+ * but runs in parallel and does not depend on the number of levels. #connectedComponents chooses between them from
+ * the density of the graph. In both engines, component \c c is the one whose smallest vertex is the \c c-th smallest,
+ * so that they return the same result.
+ */
+#ifndef COMPONENTS_H_
+#define COMPONENTS_H_
+
+#include <graph.h>
+
+#define UF_MAXDENSITY 0.0001 	//!< Largest density per thread for which #connectedComponents uses the union-find.
+
+/*!
+ * \struct Components
+ * \brief The connected components of a graph.
+ */
+typedef struct {
+	int 		k; 				//!< Number of components.
+	int * 		id; 			//!< Component of each vertex, in { 0, ..., \c k - 1 }, or -1 for the vertices not in the subgraph.
+	BitMap * 	comps; 			//!< Bitmap vector whose row \c c is the set of vertices of component \c c.
+	BitMap 		comp; 			//!< Returned as component by #component.
+} Components;
+
+/*!
+ * \fn Components * componentsByBFS(Graph * g, BitMap const * r)
+ * \brief Computes the connected components of the subgraph induced by a specified set of vertices with breadth-first searches.
+ *
+ * \param g The graph.
+ * \param r The set of vertices of the subgraph, or \c NULL for the whole graph.
+ *
+ * \return The components.
+ */
+Components * componentsByBFS(Graph * g, BitMap const * r);
+
+/*!
+ * \fn Components * componentsByUnionFind(Graph * g, BitMap const * r, int threads)
+ * \brief Computes the connected components of the subgraph induced by a specified set of vertices with a parallel union-find.
+ *
+ * Each root points to itself and the larger of two roots is linked to the smaller one, so that the root of a
+ * component is its smallest vertex. A link is a compare-and-swap of the parent of a root, retried with the new roots
+ * if another thread changed it first, and the finds halve the paths without synchronization, which is safe since a
+ * parent only moves up.
+ *
+ * \param g The graph.
+ * \param r The set of vertices of the subgraph, or \c NULL for the whole graph.
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ *
+ * \return The components.
+ */
+Components * componentsByUnionFind(Graph * g, BitMap const * r, int threads);
+
+/*!
+ * \fn Components * connectedComponents(Graph * g, BitMap const * r, int threads)
+ * \brief Computes the connected components of the subgraph induced by a specified set of vertices.
+ *
+ * The density is estimated from a sample of rows, and #componentsByUnionFind is used if it is at most
+ * #UF_MAXDENSITY times the number of threads; otherwise, #componentsByBFS is used. On a single thread, the
+ * union-find is faster only when the average degree is about 2 or less, where the searches pay a scan of the
+ * bitmaps for each one of many small components.
+ *
+ * \param g The graph.
+ * \param r The set of vertices of the subgraph, or \c NULL for the whole graph.
+ * \param threads The number of threads of the union-find, or 0 for the OpenMP default.
+ *
+ * \return The components.
+ */
+Components * connectedComponents(Graph * g, BitMap const * r, int threads);
+
+/*!
+ * \fn int countComponents(Graph * g, BitMap const * r)
+ * \brief Counts the connected components of the subgraph induced by a specified set of vertices.
+ *
+ * Same searches as #componentsByBFS, without storing the components.
+ *
+ * \param g The graph.
+ * \param r The set of vertices of the subgraph, or \c NULL for the whole graph.
+ *
+ * \return The number of components.
+ */
+int countComponents(Graph * g, BitMap const * r);
+
+/*!
+ * \fn int isForest(Graph * g, BitMap const * r)
+ * \brief Determines whether the subgraph induced by a specified set of vertices has no cycle.
+ *
+ * A graph with \c n vertices, \c m edges and \c c connected components is a forest if and only if
+ * \c m = \c n - \c c. A subgraph with no vertices is a forest. Otherwise, the edges are counted with the number of
+ * bits of the rows (restricted to \c r). As soon as there are \c n of them, the counting stops and the subgraph is not
+ * a forest. Otherwise, the components are counted with #countComponents and compared. The subgraph is never built.
+ *
+ * \param g The graph.
+ * \param r The set of vertices of the subgraph, or \c NULL for the whole graph.
+ *
+ * \return A nonzero value if the subgraph is a forest, and 0 otherwise.
+ */
+int isForest(Graph * g, BitMap const * r);
+
+/*!
+ * \fn void delComponents(Components * c)
+ * \brief Deletes specified components.
+ *
+ * \param c The components.
+ */
+void delComponents(Components * c);
+
+//!< Returns the set of vertices of component \c i in \c c. The returned bitmap is shared by all the calls.
+static inline BitMap * component(Components * c, int i) {
+	subMap(c->comps, &c->comp, i);
+	return &c->comp;
+}
+
+#endif /* COMPONENTS_H_ */
@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <cores.h>
+
+int coreDecomposition(Graph * g, int * core, int * order) {
+	const int n = g->n;
+	int * deg = (int *) malloc((n + 1) * sizeof(int));
+	int * vert = (int *) malloc((n + 1) * sizeof(int));
+	int * pos = (int *) malloc((n + 1) * sizeof(int));
+	int * bin = (int *) calloc(n + 1, sizeof(int));
+	BitMap row;
+	Node node;
+	int i, d, u, v, w, pu, pw, start, maxdeg = 0, degeneracy = 0;
+
+	// degrees and bucket sizes
+	setAsViewOf(g->matrix, &row);
+	for (v = 0; v < n; v++) {
+		subMap(g->matrix, &row, v);
+		deg[v] = cardOf(&row);
+		bin[deg[v]]++;
+		if (deg[v] > maxdeg)
+			maxdeg = deg[v];
+	}
+
+	// start of each bucket in vert
+	for (start = 0, d = 0; d <= maxdeg; d++) {
+		i = bin[d];
+		bin[d] = start;
+		start += i;
+	}
+
+	// vertices sorted by degree
+	for (v = 0; v < n; v++) {
+		pos[v] = bin[deg[v]]++;
+		vert[pos[v]] = v;
+	}
+	for (d = maxdeg; d > 0; d--)
+		bin[d] = bin[d - 1];
+	bin[0] = 0;
+
+	// removal of a vertex of minimum degree, whose neighbors of larger degree are moved one bucket down
+	for (i = 0; i < n; i++) {
+		v = vert[i];
+		if (deg[v] > degeneracy)
+			degeneracy = deg[v];
+		subMap(g->matrix, &row, v);
+		for (begin(&row, &node); !end(&node); next(&node)) {
+			u = getElement(&node);
+			if (deg[u] > deg[v]) {
+				pu = pos[u];
+				pw = bin[deg[u]];
+				w = vert[pw];
+				if (u != w) {
+					vert[pu] = w;
+					pos[w] = pu;
+					vert[pw] = u;
+					pos[u] = pw;
+				}
+				bin[deg[u]]++;
+				deg[u]--;
+			}
+		}
+	}
+
+	if (core != NULL)
+		memcpy(core, deg, n * sizeof(int));
+	if (order != NULL)
+		memcpy(order, vert, n * sizeof(int));
+
+	free(deg);
+	free(vert);
+	free(pos);
+	free(bin);
+
+	return degeneracy;
+}
+
+Graph * newDegeneracyRenumbered(Graph * g, int * R) {
+	const int n = g->n;
+	int * order = (int *) malloc((n + 1) * sizeof(int));
+	int * RR = R != NULL ? R : (int *) malloc((n + 1) * sizeof(int));
+	Graph * ret;
+	int i;
+
+	coreDecomposition(g, NULL, order);
+	for (i = 0; i < n; i++)
+		RR[order[i]] = n - 1 - i;
+	ret = newRenumbered(g, RR);
+
+	if (R == NULL)
+		free(RR);
+	free(order);
+
+	return ret;
+}
@@ -0,0 +1,48 @@
+/*!
+ * \file cores.h
+ *
+ * \date Oct 18, 2026
+ * \author Ricardo C. Corrêa (correa@ufrrj.br)
+ *
+ * \brief Core decomposition and degeneracy ordering of graphs.
+ *
+ * The \c k-core of a graph is its largest induced subgraph of minimum degree at least \c k, and the core number of a
+ * vertex is the largest \c k such that the vertex belongs to the \c k-core. The degeneracy of the graph is the largest
+ * core number. Repeatedly removing a vertex of minimum degree gives the core numbers and a degeneracy order.
+ *
+ * The implementation is the bucket queue algorithm of Batagelj and Zaversnik, which runs in time linear in the
+ * number of edges once the degrees are known. The degrees are computed by counting the bits of the rows of the adjacency matrix.
+ */
+#ifndef CORES_H_
+#define CORES_H_
+
+#include <graph.h>
+
+/*!
+ * \fn int coreDecomposition(Graph * g, int * core, int * order)
+ * \brief Computes the core numbers and a degeneracy order of the vertices of a specified graph.
+ *
+ * \param g The graph.
+ * \param core Array of size \c n where the core number of each vertex is stored, or \c NULL.
+ * \param order Array of size \c n where the vertices are stored in the order in which they are removed
+ * (nondecreasing core number, each vertex of minimum degree in the subgraph induced by itself and the vertices after it), or \c NULL.
+ *
+ * \return The degeneracy of \c g.
+ */
+int coreDecomposition(Graph * g, int * core, int * order);
+
+/*!
+ * \fn Graph * newDegeneracyRenumbered(Graph * g, int * R)
+ * \brief Creates a copy of a specified graph with the vertices renumbered in reverse degeneracy order.
+ *
+ * The last vertex removed in the core decomposition becomes vertex 0, and the first one becomes vertex \c n - 1,
+ * so that the vertices of the innermost core come first. This is the minimum width order used in clique search.
+ *
+ * \param g The graph.
+ * \param R Array of size \c n where the new number of each vertex of \c g is stored, or \c NULL.
+ *
+ * \return The renumbered graph.
+ */
+Graph * newDegeneracyRenumbered(Graph * g, int * R);
+
+#endif /* CORES_H_ */
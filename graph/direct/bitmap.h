@@ -1400,7 +1400,10 @@ static inline void addAllElements(BitMap * bm) {
 	*bm->maxRNode = RETAINLEAST(*bm->maxRNode,IDXINNODE(bm->n-1)+1);
 #elif defined(_ARCH128_) || defined(_ARCH256_)
 	int idx = IDXINNODE(bm->n-1);
-	bm->maxRNode->ui64[(unsigned int) __index[idx]] = RETAINLEAST(bm->maxRNode->ui64[(unsigned int) __index[idx]], idx-((unsigned int) __index[idx] << LOGB)+1);
+	int k = (unsigned int) __index[idx];
+	bm->maxRNode->ui64[k] &= 0xFFFFFFFFFFFFFFFFULL >> (63 - (idx & 63));
+	while (++k < (BSIZE >> 6))
+		bm->maxRNode->ui64[k] = 0;
 #endif
 
 	bm->maxRNode++;
@@ -1604,14 +1607,172 @@ static inline int isSubset(BitMap const * abmvec, BitMap const * bbmvec) {
 	for (abnode = abmvec->minRNode, bbnode = bbmvec->minRNode; abnode < abmvec->maxRNode && *abnode == (*abnode & *bbnode); abnode++, bbnode++);
 	return abnode == abmvec->maxRNode;
 #elif defined(_ARCH128_)
-	for (abnode = abmvec->minRNode, bbnode = bbmvec->minRNode; abnode < abmvec->maxRNode && _mm_comieq_ss(abnode->m, (__m128) _mm_and_si128(abnode->mi, bbnode->mi)); abnode++, bbnode++);
+	for (abnode = abmvec->minRNode, bbnode = bbmvec->minRNode; abnode < abmvec->maxRNode && _mm_testc_si128(bbnode->mi, abnode->mi); abnode++, bbnode++);
 	return abnode == abmvec->maxRNode;
 #elif defined(_ARCH256_)
-	for (abnode = abmvec->minRNode, bbnode = bbmvec->minRNode; abnode < abmvec->maxRNode && _mm256_testz_si256(abnode->mi, (__m256i) _mm256_and_pd(abnode->md, bbnode->md)); abnode++, bbnode++);
+	for (abnode = abmvec->minRNode, bbnode = bbmvec->minRNode; abnode < abmvec->maxRNode && _mm256_testc_si256(bbnode->mi, abnode->mi); abnode++, bbnode++);
 	return abnode == abmvec->maxRNode;
 #endif
 }
 
+// bit-matrix operations on bitmap vectors
+
+/*!
+ * \fn void transpose64(uint64_t * a)
+ * \brief Transpose in place a 64x64 bit matrix.
+ *
+ * The matrix is given as 64 rows of 64 bits each, and bit \c j of \c a[i] is exchanged with bit \c i of \c a[j].
+ * The transposition is done in 6 rounds, each of them swapping the off-diagonal blocks of half the size of the previous round.
+ *
+ * \param a The rows of the matrix
+ */
+static inline void transpose64(uint64_t * a) {
+	int j, k;
+	uint64_t m, t;
+
+	for (j = 32, m = 0x00000000FFFFFFFFULL; j != 0; j >>= 1, m ^= m << j)
+		for (k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+			t = ((a[k] >> j) ^ a[k | j]) & m;
+			a[k | j] ^= t;
+			a[k] ^= t << j;
+		}
+}
+
+#if defined(_ARCH64_) || defined(_ARCH128_) || defined(_ARCH256_)
+/*!
+ * \fn void transposeNode64(NODETYPE * a)
+ * \brief Transpose in place every 64x64 bit matrix in a specified tile of 64 nodes.
+ *
+ * Nodes of 128 and 256 bits hold respectively 2 and 4 matrices side by side, one in each 64-bit lane,
+ * and all of them are transposed at once with the SIMD version of the rounds of #transpose64.
+ *
+ * \param a The 64 nodes of the tile
+ */
+static inline void transposeNode64(NODETYPE * a) {
+#if defined(_ARCH64_)
+	transpose64((uint64_t *) a);
+#elif defined(_ARCH128_)
+	int j, k;
+	__m128i m, t, c;
+
+	for (j = 32, m = _mm_set1_epi64x(0x00000000FFFFFFFFLL); j != 0; j >>= 1, m = _mm_xor_si128(m, _mm_sll_epi64(m, _mm_cvtsi32_si128(j)))) {
+		c = _mm_cvtsi32_si128(j);
+		for (k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+			t = _mm_and_si128(_mm_xor_si128(_mm_srl_epi64(a[k].mi, c), a[k | j].mi), m);
+			a[k | j].mi = _mm_xor_si128(a[k | j].mi, t);
+			a[k].mi = _mm_xor_si128(a[k].mi, _mm_sll_epi64(t, c));
+		}
+	}
+#elif defined(_ARCH256_) && defined(__AVX2__)
+	int j, k;
+	__m256i m, t;
+	__m128i c;
+
+	for (j = 32, m = _mm256_set1_epi64x(0x00000000FFFFFFFFLL); j != 0; j >>= 1, m = _mm256_xor_si256(m, _mm256_sll_epi64(m, _mm_cvtsi32_si128(j)))) {
+		c = _mm_cvtsi32_si128(j);
+		for (k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+			t = _mm256_and_si256(_mm256_xor_si256(_mm256_srl_epi64(a[k].mi, c), a[k | j].mi), m);
+			a[k | j].mi = _mm256_xor_si256(a[k | j].mi, t);
+			a[k].mi = _mm256_xor_si256(a[k].mi, _mm256_sll_epi64(t, c));
+		}
+	}
+#elif defined(_ARCH256_)
+	uint64_t lane[64];
+	int l, r;
+
+	for (l = 0; l < 4; l++) {
+		for (r = 0; r < 64; r++)
+			lane[r] = a[r].ui64[l];
+		transpose64(lane);
+		for (r = 0; r < 64; r++)
+			a[r].ui64[l] = lane[r];
+	}
+#endif
+}
+#endif
+
+/*!
+ * \fn void transposeOf(BitMap * bmvec, BitMap const * abmvec)
+ * \brief Transpose of a square bitmap vector with the result in another one.
+ *
+ * Element \c j of row \c i of \c abmvec is set iff element \c i of row \c j of \c bmvec is set. Both vectors
+ * must have as many rows as elements, as the adjacency matrices created with \c newBitMapVector(n, n).
+ *
+ * Whenever nodes are multiple of 64 bits, the matrix is processed in tiles of 64 rows by one node,
+ * each of them transposed with #transposeNode64. Otherwise, every element is moved individually.
+ *
+ * \param bmvec Result bitmap vector
+ * \param abmvec Operand bitmap vector
+ */
+static inline void transposeOf(BitMap * bmvec, BitMap const * abmvec) {
+#if defined(_ARCH64_) || defined(_ARCH128_) || defined(_ARCH256_)
+	const int lanes = 1 << (LOGB-6);
+	const int bstep = (1 << bmvec->step) << (LOGB-6);
+	const int nrows = abmvec->size;
+	uint64_t * b = (uint64_t *) bmvec->R;
+	NODETYPE tile[64];
+	uint64_t * w = (uint64_t *) tile;
+	const int bused = (nrows + 63) >> 6;
+	int bb, bi, bj, r, rmax, l, c, cmax;
+
+	// the tiles write only the first words of each result row, not the upper ones of a node when n < 64
+	if (bused < bstep)
+		for (r = 0; r < abmvec->n; r++)
+			memset(b + r * bstep + bused, 0, (bstep - bused) * sizeof(uint64_t));
+
+	// 8 tiles along the columns of the result at a time, so that a cache line of each result row is filled at once
+	for (bb = 0; bb < nrows; bb += 512)
+		for (bj = 0; bj < abmvec->nRnodes; bj++)
+			for (bi = bb; bi < nrows && bi < bb + 512; bi += 64) {
+				rmax = nrows - bi < 64 ? nrows - bi : 64;
+				for (r = 0; r < rmax; r++)
+					tile[r] = abmvec->R[((bi + r) << abmvec->step) + bj];
+				memset(tile + r, 0, (64 - r) << LOGW);
+				transposeNode64(tile);
+				for (l = 0; l < lanes; l++) {
+					cmax = abmvec->n - NELEM(bj) - (l << 6);
+					cmax = cmax < 64 ? cmax : 64;
+					for (c = 0; c < cmax; c++)
+						b[(NELEM(bj) + (l << 6) + c) * bstep + (bi >> 6)] = w[(c << (LOGB-6)) + l];
+				}
+			}
+#else
+	BitMap arow, brow;
+	Node node;
+	int i;
+
+	setAsViewOf((BitMap *) abmvec, &arow);
+	setAsViewOf(bmvec, &brow);
+	for (i = 0; i < abmvec->n; i++) {
+		subMap(bmvec, &brow, i);
+		delAllElements(&brow);
+	}
+	for (i = 0; i < abmvec->size; i++) {
+		subMap((BitMap *) abmvec, &arow, i);
+		for (begin(&arow, &node); !end(&node); next(&node)) {
+			subMap(bmvec, &brow, getElement(&node));
+			addElement(&brow, i);
+		}
+	}
+#endif
+}
+
+/*!
+ * \fn void permuteRowsOf(BitMap * bmvec, BitMap const * abmvec, int const * R)
+ * \brief Copy the rows of a bitmap vector to another one in a specified order.
+ *
+ * Row \c i of \c abmvec is copied to row \c R[i] of \c bmvec.
+ *
+ * \param bmvec Result bitmap vector
+ * \param abmvec Operand bitmap vector
+ * \param R Permutation of the rows
+ */
+static inline void permuteRowsOf(BitMap * bmvec, BitMap const * abmvec, int const * R) {
+	int i;
+	for (i = 0; i < abmvec->size; i++)
+		memcpy(bmvec->R + (R[i] << bmvec->step), abmvec->R + (i << abmvec->step), abmvec->nRnodes << LOGW);
+}
+
 /*!
  * \fn void * map(BitMap const * s, void * par, void *base, size_t size, void (*f)(void *, const unsigned long long, void *))
  * \brief Transform specified collection pointed by \c base by applying \c f to all elements indexed by
@@ -1647,6 +1808,264 @@ static inline void * reduce(BitMap const * s, void * param, void *base,
 	return base;
 }
 
+#if defined(_ARCH8_) || defined(_ARCH32_) || defined(_ARCH64_)
+#define MAPWORD NODETYPE		//!< Type of the words scanned by #MAPELEMENTS.
+#define LOGMAPWORD LOGB			//!< Logarithmic of the number of bits in a #MAPWORD.
+#elif defined(_ARCH128_) || defined(_ARCH256_)
+#define MAPWORD uint64_t
+#define LOGMAPWORD 6
+#endif
+
+/*!
+ * \def MAPELEMENTS(s, i, body)
+ * \brief Executes \c body once for each element \c i of bitmap \c s, in increasing order.
+ *
+ * Inlined alternative to #map and #reduce: the statement \c body is expanded in place, so that it can be
+ * optimized together with the loop. The bitmap is scanned in words of #MAPWORD. A word with all its bits set
+ * is handled as a contiguous run of elements by a counted loop, which the compiler is able to vectorize;
+ * the other words are scanned by extracting their least significant bit. Example:
+ * \code{.c}
+   double sum = 0.0;
+   int i;
+   MAPELEMENTS(s, i, sum += w[i]);
+   \endcode
+ * \c body may use \c continue, but not \c break.
+ *
+ * \param s The bitmap.
+ * \param i An \c int variable assigned to each element.
+ * \param body The statement to execute.
+ */
+#define MAPELEMENTS(s, i, body) do { \
+	MAPWORD const * __mw = (MAPWORD const *) (s)->R; \
+	const int __mn = (s)->nRnodes << (LOGB - LOGMAPWORD); \
+	unsigned long long __mx; \
+	int __mk, __me; \
+	for (__mk = 0; __mk < __mn; __mk++) { \
+		if (__mw[__mk] == (MAPWORD) ~(MAPWORD) 0) { \
+			for (i = __mk << LOGMAPWORD, __me = i + (1 << LOGMAPWORD); i < __me; i++) { \
+				body; \
+			} \
+		} \
+		else \
+			for (__mx = __mw[__mk]; __mx; ) { \
+				i = (__mk << LOGMAPWORD) + __builtin_ctzll(__mx); \
+				__mx &= __mx - 1; \
+				body; \
+			} \
+	} \
+} while (0)
+
+/*!
+ * \fn double sumRun(double const * w, int n)
+ * \brief Sum of the \c n consecutive elements of a specified array.
+ */
+static inline double sumRun(double const * w, int n) {
+	int k;
+#if defined(_ARCH256_)
+	__m256d acc0 = _mm256_setzero_pd();
+	__m256d acc1 = _mm256_setzero_pd();
+	double a[4] __attribute__((aligned(32)));
+	for (k = 0; k + 8 <= n; k += 8) {
+		acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(w + k));
+		acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(w + k + 4));
+	}
+	_mm256_store_pd(a, _mm256_add_pd(acc0, acc1));
+	double r = (a[0] + a[1]) + (a[2] + a[3]);
+#elif defined(_ARCH128_)
+	__m128d acc0 = _mm_setzero_pd();
+	__m128d acc1 = _mm_setzero_pd();
+	double a[2] __attribute__((aligned(16)));
+	for (k = 0; k + 4 <= n; k += 4) {
+		acc0 = _mm_add_pd(acc0, _mm_loadu_pd(w + k));
+		acc1 = _mm_add_pd(acc1, _mm_loadu_pd(w + k + 2));
+	}
+	_mm_store_pd(a, _mm_add_pd(acc0, acc1));
+	double r = a[0] + a[1];
+#else
+	double r0 = 0.0, r1 = 0.0, r2 = 0.0, r3 = 0.0;
+	for (k = 0; k + 4 <= n; k += 4) {
+		r0 += w[k];
+		r1 += w[k+1];
+		r2 += w[k+2];
+		r3 += w[k+3];
+	}
+	double r = (r0 + r1) + (r2 + r3);
+#endif
+	for (; k < n; k++)
+		r += w[k];
+
+	return r;
+}
+
+/*!
+ * \fn double maxRun(double const * w, int n)
+ * \brief Maximum of the \c n > 0 consecutive elements of a specified array.
+ */
+static inline double maxRun(double const * w, int n) {
+	int k;
+#if defined(_ARCH256_)
+	double a[4] __attribute__((aligned(32)));
+	double r = w[0];
+	if (n >= 4) {
+		__m256d acc = _mm256_loadu_pd(w);
+		for (k = 4; k + 4 <= n; k += 4)
+			acc = _mm256_max_pd(acc, _mm256_loadu_pd(w + k));
+		_mm256_store_pd(a, acc);
+		r = a[0] > a[1] ? a[0] : a[1];
+		r = r > a[2] ? r : a[2];
+		r = r > a[3] ? r : a[3];
+	}
+	else
+		k = 1;
+#elif defined(_ARCH128_)
+	double a[2] __attribute__((aligned(16)));
+	double r = w[0];
+	if (n >= 2) {
+		__m128d acc = _mm_loadu_pd(w);
+		for (k = 2; k + 2 <= n; k += 2)
+			acc = _mm_max_pd(acc, _mm_loadu_pd(w + k));
+		_mm_store_pd(a, acc);
+		r = a[0] > a[1] ? a[0] : a[1];
+	}
+	else
+		k = 1;
+#else
+	double r = w[0];
+	k = 1;
+#endif
+	for (; k < n; k++)
+		r = r > w[k] ? r : w[k];
+
+	return r;
+}
+
+/*!
+ * \fn double sumOf(BitMap const * s, double const * w)
+ * \brief Sum of the weights of the elements of a specified bitmap.
+ *
+ * Runs of elements covering whole words of the bitmap are added with #sumRun.
+ *
+ * \param s The bitmap.
+ * \param w The weights, indexed by the elements.
+ *
+ * \return \f$\sum_{i \in s} w_i\f$.
+ */
+static inline double sumOf(BitMap const * s, double const * w) {
+	MAPWORD const * mw = (MAPWORD const *) s->R;
+	const int mn = s->nRnodes << (LOGB - LOGMAPWORD);
+	unsigned long long x;
+	double r = 0.0;
+	int k;
+
+	for (k = 0; k < mn; k++)
+		if (mw[k] == (MAPWORD) ~(MAPWORD) 0)
+			r += sumRun(w + (k << LOGMAPWORD), 1 << LOGMAPWORD);
+		else
+			for (x = mw[k]; x; x &= x - 1)
+				r += w[(k << LOGMAPWORD) + __builtin_ctzll(x)];
+
+	return r;
+}
+
+/*!
+ * \fn int argmaxOf(BitMap const * s, double const * w)
+ * \brief Element of a specified bitmap with maximum weight.
+ *
+ * Runs of elements covering whole words of the bitmap are scanned with #maxRun, and searched for the
+ * index of the maximum only if it improves the current one. Ties are broken in favor of the least element.
+ * The search never leaves the run: a run whose maximum is not found in it (a NaN weight) is scanned element by element.
+ *
+ * \param s The bitmap.
+ * \param w The weights, indexed by the elements.
+ *
+ * \return The least \f$i \in s\f$ such that \f$w_i = \max_{j \in s} w_j\f$, or -1 if \c s is empty.
+ */
+static inline int argmaxOf(BitMap const * s, double const * w) {
+	MAPWORD const * mw = (MAPWORD const *) s->R;
+	const int mn = s->nRnodes << (LOGB - LOGMAPWORD);
+	unsigned long long x;
+	double m, best = 0.0;
+	int k, i, e, arg = -1;
+
+	for (k = 0; k < mn; k++) {
+		x = mw[k];
+		if (x == (MAPWORD) ~(MAPWORD) 0) {
+			i = k << LOGMAPWORD;
+			e = i + (1 << LOGMAPWORD);
+			m = maxRun(w + i, 1 << LOGMAPWORD);
+			if (arg >= 0 && !(m > best))
+				continue;
+			// m is not in the run if it is NaN, in which case the run is scanned element by element
+			for (; i < e && w[i] != m; i++);
+			if (i < e) {
+				best = m;
+				arg = i;
+				continue;
+			}
+		}
+		for (; x; x &= x - 1) {
+			i = (k << LOGMAPWORD) + __builtin_ctzll(x);
+			if (arg < 0 || w[i] > best) {
+				best = w[i];
+				arg = i;
+			}
+		}
+	}
+
+	return arg;
+}
+
+/*!
+ * \fn double maxOf(BitMap const * s, double const * w)
+ * \brief Maximum weight of the elements of a specified bitmap.
+ *
+ * \param s The bitmap.
+ * \param w The weights, indexed by the elements.
+ *
+ * \return \f$\max_{i \in s} w_i\f$, or 0 if \c s is empty.
+ */
+static inline double maxOf(BitMap const * s, double const * w) {
+	int i = argmaxOf(s, w);
+	return i < 0 ? 0.0 : w[i];
+}
+
+/*!
+ * \fn int cardOfIntersectionFrom(BitMap const * abmvec, BitMap const * bbmvec, int i)
+ * \brief Number of elements not smaller than a specified one in the intersection of two bitmaps.
+ *
+ * The intersection is not stored: the words of both bitmaps are combined with a logic \c AND and counted on the fly.
+ *
+ * \param abmvec First bitmap.
+ * \param bbmvec Second bitmap.
+ * \param i Smallest element to count.
+ *
+ * \return \f$|\{ j \in abmvec \cap bbmvec : j \geq i \}|\f$.
+ */
+static inline int cardOfIntersectionFrom(BitMap const * abmvec, BitMap const * bbmvec, int i) {
+	MAPWORD const * a = (MAPWORD const *) abmvec->R;
+	MAPWORD const * b = (MAPWORD const *) bbmvec->R;
+	const int mn = abmvec->nRnodes << (LOGB - LOGMAPWORD);
+	int k = i >> LOGMAPWORD;
+	int ret0, ret1 = 0;
+
+	if (k >= mn)
+		return 0;
+	ret0 = __builtin_popcountll(((unsigned long long) (MAPWORD) (a[k] & b[k])) & (~0ULL << (i & ((1 << LOGMAPWORD) - 1))));
+	for (k++; k + 1 < mn; k += 2) {
+		ret0 += __builtin_popcountll(a[k] & b[k]);
+		ret1 += __builtin_popcountll(a[k+1] & b[k+1]);
+	}
+	if (k < mn)
+		ret0 += __builtin_popcountll(a[k] & b[k]);
+
+	return ret0 + ret1;
+}
+
+//!< Returns the number of elements in the intersection of bitmaps \c abmvec and \c bbmvec, without storing it.
+static inline int cardOfIntersection(BitMap const * abmvec, BitMap const * bbmvec) {
+	return cardOfIntersectionFrom(abmvec, bbmvec, 0);
+}
+
 static inline void printSetElements(BitMap const * s) {
 	Node node;
 	printf("[");
@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <bfs.h>
+#include <eccentricity.h>
+
+static int numThreads(int threads) {
+#ifdef _OPENMP
+	return threads > 0 ? threads : omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+
+/*
+ * Open vertex, with the key by which the sources of a round are chosen (its upper bound negated, or its lower bound)
+ * and its degree, so that the comparison function of qsort needs nothing but its arguments.
+ */
+typedef struct {
+	int 		key;
+	int 		deg;
+	int 		v;
+} OpenVertex;
+
+// smallest key first, ties broken by the largest degree and then by the smallest vertex
+static int byKey(const void * x, const void * y) {
+	const OpenVertex * a = (const OpenVertex *) x;
+	const OpenVertex * b = (const OpenVertex *) y;
+	if (a->key != b->key)
+		return a->key < b->key ? -1 : 1;
+	return a->deg != b->deg ? b->deg - a->deg : a->v - b->v;
+}
+
+int eccentricities(Graph * g, int * ecc, int * diameter, int * radius, int threads) {
+	const int n = g->n;
+	int * lo = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	int * hi = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	int * deg = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	OpenVertex * open = (OpenVertex *) malloc((n > 0 ? n : 1) * sizeof(OpenVertex));
+	int * src;
+	int * dist;
+	BitMap row;
+	int i, j, v, t, e, d, no, nb, nh, nbatches, searches = 0;
+
+	threads = numThreads(threads);
+	src = (int *) malloc(threads * BFS_LANES * sizeof(int));
+	dist = (int *) malloc((size_t) threads * BFS_LANES * (n > 0 ? n : 1) * sizeof(int));
+
+	setAsViewOf(g->matrix, &row);
+	for (v = 0; v < n; v++) {
+		subMap(g->matrix, &row, v);
+		deg[v] = cardOf(&row);
+		lo[v] = deg[v] > 0 ? 1 : 0;
+		hi[v] = deg[v] > 0 ? n - 1 : 0;
+		if (deg[v] == n - 1)
+			hi[v] = lo[v];
+	}
+
+	for (;;) {
+		for (no = 0, v = 0; v < n; v++)
+			if (lo[v] < hi[v]) {
+				open[no].key = -hi[v];
+				open[no].deg = deg[v];
+				open[no++].v = v;
+			}
+		if (no == 0)
+			break;
+
+		// half of the sources of the round with the largest upper bounds, half with the smallest lower bounds
+		nb = no < threads * BFS_LANES ? no : threads * BFS_LANES;
+		nh = (nb + 1) >> 1;
+		qsort(open, no, sizeof(OpenVertex), byKey);
+		for (i = 0; i < nh; i++)
+			src[i] = open[i].v;
+		for (i = nh; i < no; i++)
+			open[i].key = lo[open[i].v];
+		qsort(open + nh, no - nh, sizeof(OpenVertex), byKey);
+		for (i = nh; i < nb; i++)
+			src[i] = open[i].v;
+
+		nbatches = (nb + BFS_LANES - 1) / BFS_LANES;
+#pragma omp parallel for num_threads(threads) schedule(dynamic, 1)
+		for (t = 0; t < nbatches; t++)
+			bfsMulti(g, src + t * BFS_LANES, nb - t * BFS_LANES < BFS_LANES ? nb - t * BFS_LANES : BFS_LANES,
+					dist + (size_t) t * BFS_LANES * n);
+		searches += nb;
+
+		for (i = 0; i < nb; i++) {
+			int const * di = dist + (size_t) i * n;
+			for (e = 0, v = 0; v < n; v++)
+				if (di[v] > e)
+					e = di[v];
+			for (v = 0; v < n; v++) {
+				if ((d = di[v]) < 0)
+					continue;
+				j = d > e - d ? d : e - d;
+				if (j > lo[v])
+					lo[v] = j;
+				if (e + d < hi[v])
+					hi[v] = e + d;
+			}
+		}
+	}
+
+	if (diameter != NULL)
+		for (*diameter = 0, v = 0; v < n; v++)
+			if (lo[v] > *diameter)
+				*diameter = lo[v];
+	if (radius != NULL)
+		for (*radius = n > 0 ? lo[0] : 0, v = 1; v < n; v++)
+			if (lo[v] < *radius)
+				*radius = lo[v];
+	if (ecc != NULL)
+		memcpy(ecc, lo, n * sizeof(int));
+
+	free(lo);
+	free(hi);
+	free(deg);
+	free(open);
+	free(src);
+	free(dist);
+
+	return searches;
+}
@@ -0,0 +1,38 @@
+/*!
+ * \file eccentricity.h
+ *
+ * \date Oct 18, 2026
+ * \author Ricardo C. Corrêa (correa@ufrrj.br)
+ *
+ * \brief Eccentricities, diameter and radius of undirected graphs.
+ *
+ * The eccentricity of a vertex is its largest distance to a vertex of its connected component. After a search from a
+ * vertex \c w, with eccentricity \f$e(w)\f$, the eccentricity of each vertex \c v of the component of \c w satisfies
+ * \f[\max(d(w, v), e(w) - d(w, v)) \le e(v) \le e(w) + d(w, v),\f]
+ * and a vertex whose bounds meet needs no search of its own. This is the bounding algorithm of Takes and Kosters, where
+ * the next sources are chosen alternately among the vertices of largest upper bound and of smallest lower bound.
+ * Here, the sources are searched in batches with #bfsMulti, and the batches of a round are distributed to the threads.
+ */
+#ifndef ECCENTRICITY_H_
+#define ECCENTRICITY_H_
+
+#include <graph.h>
+
+/*!
+ * \fn int eccentricities(Graph * g, int * ecc, int * diameter, int * radius, int threads)
+ * \brief Computes the eccentricities, the diameter and the radius of a specified undirected graph.
+ *
+ * Eccentricities are taken in the connected component of each vertex, so that the diameter is the largest one over
+ * the components, and the radius is the smallest eccentricity of a vertex (0 if the graph has an isolated vertex).
+ *
+ * \param g The graph.
+ * \param ecc Array of size \c n where the eccentricity of each vertex is stored, or \c NULL.
+ * \param diameter Where the diameter is stored, or \c NULL.
+ * \param radius Where the radius is stored, or \c NULL.
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ *
+ * \return The number of breadth-first searches done, which is at most \c n.
+ */
+int eccentricities(Graph * g, int * ecc, int * diameter, int * radius, int threads);
+
+#endif /* ECCENTRICITY_H_ */
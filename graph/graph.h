@@ -24,7 +24,7 @@
  */
 typedef struct {
 	size_t 		n; 				//!< Number of vertices
-	size_t 		m; 				//!< Number of edges
+	size_t 		m; 				//!< Number of edges (of arcs, if the graph is built with the arc functions), maintained by the functions of this header that change the graph, and recounted by #countEdges.
 	BitMap *	matrix; 		//!< Bitmap adjacency matrix.
 	BitMap *	swap; 			//!< Bitmap used in the swap operation.
 	BitMap 		neig; 			//!< Returned as neighborhood of a specified vertex.
@@ -51,6 +51,9 @@ static inline Graph * newGraph(size_t n) {
 	ret->swap = newBitMap(n);
 	setAsViewOf(ret->matrix, &ret->neig);
 	ret->n = n;
+	ret->m = 0;
+	ret->maxcq = 0;
+	ret->maxwcq = 0.0;
 
 //	printf("ret-matrix-R=%d  n=%d  logrow=%d  LOGB=%ld  matsz=%d\n",(int)ret->matrix->R, n, ret->logrowsizelogb, LOGB, ret->matrixsize);
 
@@ -83,84 +86,428 @@ static inline int hasEdge(Graph * g, unsigned long long int i, unsigned long lon
 	return hasElement(&g->neig, j);
 }
 
-static inline void addEdge(Graph * g, unsigned long long int i, unsigned long long int j) {
+//!< Adds the edge \c {i,j} to \c g, and returns the change (1 or 0) in the number of edges.
+static inline int addEdge(Graph * g, unsigned long long int i, unsigned long long int j) {
 	Node node;
 	subMap(g->matrix, &g->neig, i);
+	if (hasElement(&g->neig, j))
+		return 0;
 	addElement(&g->neig, j);
+	g->m++;
 
 	subMap(g->matrix, &g->neig, j);
 	addElement(&g->neig, i);
+	return 1;
 }
 
-static inline void invEdge(Graph * g, unsigned long long int i, unsigned long long int j) {
+//!< Adds the edge \c {i,j} to \c g if it is not there, and removes it otherwise. Returns the change (1 or -1) in the number of edges, or 0 if \c i = \c j, which leaves \c g unchanged.
+static inline int invEdge(Graph * g, unsigned long long int i, unsigned long long int j) {
 	Node node;
+	int delta;
+	if (i == j)
+		return 0;
+	delta = hasEdge(g, i, j) ? -1 : 1;
 	subMap(g->matrix, &g->neig, i);
 	invElement(&g->neig, j);
+	g->m += delta;
 
 	subMap(g->matrix, &g->neig, j);
 	invElement(&g->neig, i);
+	return delta;
 }
 
-static inline void addArc(Graph * g, unsigned long long int i, unsigned long long int j) {
+//!< Removes the edge \c {i,j} from \c g, and returns the change (-1 or 0) in the number of edges.
+static inline int delEdge(Graph * g, unsigned long long int i, unsigned long long int j) {
 	Node node;
 	subMap(g->matrix, &g->neig, i);
+	if (!hasElement(&g->neig, j))
+		return 0;
+	delElement(&g->neig, j);
+	g->m--;
+
+	subMap(g->matrix, &g->neig, j);
+	delElement(&g->neig, i);
+	return -1;
+}
+
+//!< Adds the arc \c (i,j) to \c g, and returns the change (1 or 0) in the number of arcs.
+static inline int addArc(Graph * g, unsigned long long int i, unsigned long long int j) {
+	Node node;
+	subMap(g->matrix, &g->neig, i);
+	if (hasElement(&g->neig, j))
+		return 0;
 	addElement(&g->neig, j);
+	g->m++;
+	return 1;
 }
 
-static inline void delArc(Graph * g, unsigned long long int i, unsigned long long int j) {
+//!< Removes the arc \c (i,j) from \c g, and returns the change (-1 or 0) in the number of arcs.
+static inline int delArc(Graph * g, unsigned long long int i, unsigned long long int j) {
 	Node node;
 	subMap(g->matrix, &g->neig, i);
+	if (!hasElement(&g->neig, j))
+		return 0;
 	delElement(&g->neig, j);
+	g->m--;
+	return -1;
 }
 
-static inline void invArc(Graph * g, unsigned long long int i, unsigned long long int j) {
+//!< Adds the arc \c (i,j) to \c g if it is not there, and removes it otherwise. Returns the change (1 or -1) in the number of arcs.
+static inline int invArc(Graph * g, unsigned long long int i, unsigned long long int j) {
 	Node node;
+	const int delta = hasEdge(g, i, j) ? -1 : 1;
 	subMap(g->matrix, &g->neig, i);
 	invElement(&g->neig, j);
+	g->m += delta;
+	return delta;
 }
 
 static inline void addAllEdges(Graph * g) {
 	int i;
 	for (i = 0; i < g->n; i++) {
 		subMap(g->matrix, &g->neig, i);
-		fill(&g->neig);
-		invArc(g, i, i);
+		addAllElements(&g->neig);
+		invElement(&g->neig, i);
 	}
+	g->m = g->n * (g->n - 1) / 2;
 }
 
-static inline void swapVertices(Graph * g, unsigned long long int i, unsigned long long int j) {
+/*!
+ * \fn size_t countEdges(Graph * g)
+ * \brief Counts the edges of a specified undirected graph with no loops and stores their number in \c g->m.
+ *
+ * The edges are counted with the number of bits of the rows of the adjacency matrix. This is meant for the graphs
+ * read by the prebuilt main library, whose number of edges is the one in the file header, with any duplicate edge
+ * counted twice.
+ *
+ * \param g The graph.
+ *
+ * \return The number of edges of \c g.
+ */
+static inline size_t countEdges(Graph * g) {
+	BitMap row;
+	size_t m = 0;
+	int i;
+
+	setAsViewOf(g->matrix, &row);
+	for (i = 0; i < g->n; i++) {
+		subMap(g->matrix, &row, i);
+		m += cardOf(&row);
+	}
+	g->m = m >> 1;
+	return g->m;
+}
+
+static inline void swapRowsAndColumns(BitMap * matrix, BitMap * swap, unsigned long long int i, unsigned long long int j) {
+	BitMap rowi, rowj;
+	Node node;
+
+	setAsViewOf(matrix, &rowi);
+	setAsViewOf(matrix, &rowj);
+	subMap(matrix, &rowi, i);
+	subMap(matrix, &rowj, j);
+
 	// swap lines
-	transcript(g->swap, neig(g, i));
-	subMap(g->matrix, &g->neig, i);
-	transcript(&g->neig, neig(g, j));
-	subMap(g->matrix, &g->neig, j);
-	transcript(&g->neig, g->swap);
+	copyAll(swap, &rowi);
+	copyAll(&rowi, &rowj);
+	copyAll(&rowj, swap);
 
 	// swap columns
-	symDiff(g->swap, neig(g, j));
-	Node node;
-	for (begin(g->swap, &node); !end(&node); next(&node))
+	symDiff(swap, &rowi);
+	for (begin(swap, &node); !end(&node); next(&node))
 	{
-		int k = getElement(&node);
-		invArc(g,k,i);
-		invArc(g,k,j);
+		subMap(matrix, &rowi, getElement(&node));
+		invElement(&rowi, i);
+		invElement(&rowi, j);
 	}
 }
 
-static inline Graph * newRenumbered(Graph * gg, int * R) {
-	int n = gg->n;
+//!< Exchanges the numbers of vertices \c i and \c j of the undirected graph \c g.
+static inline void swapVertices(Graph * g, unsigned long long int i, unsigned long long int j) {
+	swapRowsAndColumns(g->matrix, g->swap, i, j);
+}
 
-	Graph * g = newGraph(n);
+/*!
+ * \struct Degrees
+ * \brief Degrees and maximum degree of the vertices of a graph.
+ *
+ * The degree of a vertex is the number of bits of its row of the adjacency matrix. The degrees are kept apart from
+ * #Graph, whose layout must stay the one the prebuilt main library (\c libtrab_main) was compiled with, so the graphs
+ * it reads have no degrees and the functions that may receive them count the bits of the rows. A graph whose degrees
+ * are maintained is changed with #addEdgeDeg, #delEdgeDeg, #invEdgeDeg, #addArcDeg, #delArcDeg, #invArcDeg and
+ * #swapVerticesDeg, which update both, and its degrees are rebuilt with #rebuildDegrees after a change in bulk.
+ * A histogram of the degrees lets the maximum degree go down in constant time when its last vertex loses an edge.
+ */
+typedef struct {
+	int 		n; 				//!< Number of vertices.
+	int * 		deg; 			//!< Degree of each vertex.
+	int * 		cnt; 			//!< Number of vertices of each degree.
+	int 		max; 			//!< Maximum degree.
+} Degrees;
 
+//!< Recomputes the degrees \c d from the adjacency matrix of \c g, after a change in bulk.
+static inline void rebuildDegrees(Degrees * d, Graph * g) {
+	BitMap row;
 	int i;
-	Node node;
-	for (i = 0; i < n; i++)
-		for (begin(neig(gg,i), &node); !end(&node); next(&node))
-			addEdge(g,R[i],R[getElement(&node)]);
 
+	memset(d->cnt, 0, (d->n + 1) * sizeof(int));
+	d->max = 0;
+	setAsViewOf(g->matrix, &row);
+	for (i = 0; i < d->n; i++) {
+		subMap(g->matrix, &row, i);
+		d->deg[i] = cardOf(&row);
+		d->cnt[d->deg[i]]++;
+		if (d->deg[i] > d->max)
+			d->max = d->deg[i];
+	}
+}
+
+/*!
+ * \fn Degrees * newDegrees(Graph * g)
+ * \brief Creates the degrees of a specified graph.
+ *
+ * \param g The graph.
+ *
+ * \return The degrees, computed with #rebuildDegrees.
+ */
+static inline Degrees * newDegrees(Graph * g) {
+	Degrees * d = (Degrees *) malloc(sizeof(Degrees));
+	d->n = g->n;
+	d->deg = (int *) malloc((g->n > 0 ? g->n : 1) * sizeof(int));
+	d->cnt = (int *) malloc((g->n + 1) * sizeof(int));
+	rebuildDegrees(d, g);
+	return d;
+}
+
+//!< Deletes the degrees \c d.
+static inline void delDegrees(Degrees * d) {
+	free(d->deg);
+	free(d->cnt);
+	free(d);
+}
+
+//!< Adds \c delta (1, 0 or -1, as returned by the functions that change the graph) to the degree of \c i in \c d.
+static inline void updateDegree(Degrees * d, int i, int delta) {
+	if (delta == 0)
+		return;
+	d->cnt[d->deg[i]]--;
+	d->deg[i] += delta;
+	d->cnt[d->deg[i]]++;
+	if (d->deg[i] > d->max)
+		d->max = d->deg[i];
+	else if (d->cnt[d->max] == 0)
+		d->max--;
+}
+
+//!< Adds \c delta to the degrees of the ends \c i and \c j of an edge in \c d (once if \c i = \c j), and returns \c delta.
+static inline int updateEdgeDegrees(Degrees * d, int i, int j, int delta) {
+	updateDegree(d, i, delta);
+	if (j != i)
+		updateDegree(d, j, delta);
+	return delta;
+}
+
+//!< Same as #addEdge, also updating the degrees \c d of \c g.
+static inline int addEdgeDeg(Graph * g, Degrees * d, unsigned long long int i, unsigned long long int j) {
+	return updateEdgeDegrees(d, i, j, addEdge(g, i, j));
+}
+
+//!< Same as #delEdge, also updating the degrees \c d of \c g.
+static inline int delEdgeDeg(Graph * g, Degrees * d, unsigned long long int i, unsigned long long int j) {
+	return updateEdgeDegrees(d, i, j, delEdge(g, i, j));
+}
+
+//!< Same as #invEdge, also updating the degrees \c d of \c g.
+static inline int invEdgeDeg(Graph * g, Degrees * d, unsigned long long int i, unsigned long long int j) {
+	return updateEdgeDegrees(d, i, j, invEdge(g, i, j));
+}
+
+//!< Same as #addArc, also updating the degrees \c d of \c g.
+static inline int addArcDeg(Graph * g, Degrees * d, unsigned long long int i, unsigned long long int j) {
+	const int delta = addArc(g, i, j);
+	updateDegree(d, i, delta);
+	return delta;
+}
+
+//!< Same as #delArc, also updating the degrees \c d of \c g.
+static inline int delArcDeg(Graph * g, Degrees * d, unsigned long long int i, unsigned long long int j) {
+	const int delta = delArc(g, i, j);
+	updateDegree(d, i, delta);
+	return delta;
+}
+
+//!< Same as #invArc, also updating the degrees \c d of \c g.
+static inline int invArcDeg(Graph * g, Degrees * d, unsigned long long int i, unsigned long long int j) {
+	const int delta = invArc(g, i, j);
+	updateDegree(d, i, delta);
+	return delta;
+}
+
+//!< Same as #swapVertices, also updating the degrees \c d of \c g.
+static inline void swapVerticesDeg(Graph * g, Degrees * d, unsigned long long int i, unsigned long long int j) {
+	int t;
+
+	swapVertices(g, i, j);
+	t = d->deg[i];
+	d->deg[i] = d->deg[j];
+	d->deg[j] = t;
+}
+
+/*!
+ * \fn void renumberInto(Graph * g, Graph * gg, int const * R)
+ * \brief Copies a specified graph into another one with its vertices renumbered.
+ *
+ * Vertex \c i of \c gg becomes vertex \c R[i] of \c g, so that \c g has the arc \c (R[i],R[j]) iff \c gg has the arc \c (i,j).
+ * Both graphs must have the same number of vertices, and they are allowed to be the same graph.
+ *
+ * The rows of the adjacency matrix are moved with \c memcpy and its columns are moved by transposing the matrix,
+ * moving the rows again and transposing it back, so that no element is handled individually. The degrees of \c g
+ * (see #Degrees), if any, are to be rebuilt with #rebuildDegrees.
+ *
+ * \param g The renumbered graph.
+ * \param gg The graph to renumber.
+ * \param R The new number of each vertex of \c gg.
+ */
+static inline void renumberInto(Graph * g, Graph * gg, int const * R) {
+	BitMap * aux = newBitMapVector(gg->n, gg->n);
+
+	permuteRowsOf(aux, gg->matrix, R);
+	transposeOf(g->matrix, aux);
+	permuteRowsOf(aux, g->matrix, R);
+	transposeOf(g->matrix, aux);
+	g->m = gg->m;
+
+	freeBitMap(aux);
+}
+
+/*!
+ * \fn Graph * newRenumbered(Graph * gg, int * R)
+ * \brief Creates a new graph as a copy of a specified graph with its vertices renumbered.
+ *
+ * \param gg The graph to renumber.
+ * \param R The new number of each vertex of \c gg.
+ *
+ * \return The graph where vertex \c i of \c gg is numbered \c R[i].
+ *
+ * \see renumberInto
+ */
+static inline Graph * newRenumbered(Graph * gg, int * R) {
+	Graph * g = newGraph(gg->n);
+	renumberInto(g, gg, R);
 	return g;
 }
 
+#define ROWBLOCK (4096 >> LOGW)		//!< Number of nodes in the column blocks of the multi-row operations (4 KB).
+
+/*!
+ * \fn void unionOfRows(Graph * g, BitMap const * s, BitMap * r)
+ * \brief Union of the neighborhoods of the vertices in a specified set.
+ *
+ * The adjacency matrix is processed in blocks of #ROWBLOCK columns, and all the rows indexed by \c s are
+ * accumulated on a block of \c r before moving to the next one, so that the block of the result stays in the cache.
+ *
+ * \param g The graph.
+ * \param s The set of vertices.
+ * \param r The bitmap where to store \f$\bigcup_{v \in s} N(v)\f$.
+ */
+static inline void unionOfRows(Graph * g, BitMap const * s, BitMap * r) {
+	const int nn = g->matrix->nRnodes;
+	NODETYPE * row;
+	NODETYPE * out;
+	Node node;
+	int b, e, k;
+
+	delAllElements(r);
+	out = r->R;
+	for (b = 0; b < nn; b += ROWBLOCK) {
+		e = b + ROWBLOCK < nn ? b + ROWBLOCK : nn;
+		for (begin(s, &node); !end(&node); next(&node)) {
+			row = g->matrix->R + (getElement(&node) << g->matrix->step);
+#if defined(_ARCH8_) || defined(_ARCH32_) || defined(_ARCH64_)
+			for (k = b; k < e; k++)
+				out[k] |= row[k];
+#elif defined(_ARCH128_)
+			for (k = b; k < e; k++)
+				out[k].mi = _mm_or_si128(out[k].mi, row[k].mi);
+#elif defined(_ARCH256_)
+			for (k = b; k < e; k++)
+				out[k].md = _mm256_or_pd(out[k].md, row[k].md);
+#endif
+		}
+	}
+}
+
+/*!
+ * \fn int intersectOfRows(Graph * g, BitMap const * s, BitMap * r)
+ * \brief Intersection of the neighborhoods of the vertices in a specified set.
+ *
+ * The adjacency matrix is processed in blocks of #ROWBLOCK columns, as in #unionOfRows. The rows indexed by \c s
+ * are intersected on a block of \c r until the block becomes empty, in which case the remaining rows are skipped for that block.
+ * The intersection of an empty family of neighborhoods is the set of all vertices.
+ *
+ * \param g The graph.
+ * \param s The set of vertices.
+ * \param r The bitmap where to store \f$\bigcap_{v \in s} N(v)\f$.
+ *
+ * \return 0 if the intersection is empty, and a non-zero value otherwise.
+ */
+static inline int intersectOfRows(Graph * g, BitMap const * s, BitMap * r) {
+	const int nn = g->matrix->nRnodes;
+	NODETYPE * row;
+	NODETYPE * out;
+	Node node;
+	int b, e, k, ret = 0;
+#if defined(_ARCH8_) || defined(_ARCH32_) || defined(_ARCH64_)
+	NODETYPE acc;
+#elif defined(_ARCH128_)
+	__m128i acc;
+#elif defined(_ARCH256_)
+	__m256d acc;
+#endif
+
+	begin(s, &node);
+	if (end(&node)) {
+		addAllElements(r);
+		return g->n > 0;
+	}
+
+	out = r->R;
+	for (b = 0; b < nn; b += ROWBLOCK) {
+		e = b + ROWBLOCK < nn ? b + ROWBLOCK : nn;
+		begin(s, &node);
+		row = g->matrix->R + (getElement(&node) << g->matrix->step);
+		memcpy(out + b, row + b, (e - b) << LOGW);
+		for (next(&node); !end(&node); next(&node)) {
+			row = g->matrix->R + (getElement(&node) << g->matrix->step);
+#if defined(_ARCH8_) || defined(_ARCH32_) || defined(_ARCH64_)
+			for (acc = 0, k = b; k < e; k++)
+				acc |= (out[k] &= row[k]);
+			if (acc == 0)
+				break;
+#elif defined(_ARCH128_)
+			for (acc = _mm_setzero_si128(), k = b; k < e; k++) {
+				out[k].mi = _mm_and_si128(out[k].mi, row[k].mi);
+				acc = _mm_or_si128(acc, out[k].mi);
+			}
+			if (_mm_testz_si128(acc, acc))
+				break;
+#elif defined(_ARCH256_)
+			for (acc = _mm256_setzero_pd(), k = b; k < e; k++) {
+				out[k].md = _mm256_and_pd(out[k].md, row[k].md);
+				acc = _mm256_or_pd(acc, out[k].md);
+			}
+			if (_mm256_testz_si256((__m256i) acc, (__m256i) acc))
+				break;
+#endif
+		}
+		if (!ret)
+			for (k = b; k < e && !ret; k++)
+				ret = NODEISNOTEMPTY(out[k]);
+	}
+
+	return ret;
+}
+
 #ifdef _DEBUG_
 static inline void printNeigNodes(Graph * g, int i) {
 	int lastnode = NODEIDX(g->n-1);
@@ -68,7 +68,6 @@ Graph * readDimacsGraph(FILE* graphFile) {
 	// Graph variables
 	////
 	Graph * g = newGraph(n);
-	g->m = m;
 
 	type = fgetc(graphFile);
 	while (type != EOF) {
@@ -94,6 +93,8 @@ Graph * readDimacsGraph(FILE* graphFile) {
 		}
 		type = fgetc(graphFile);
 	}
+	// the number in the header, as in the prebuilt main library (addEdge also counts the edges, see countEdges)
+	g->m = m;
 	printf("\t#Finishes reading graph\n");
 
 	return g;
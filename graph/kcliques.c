@@ -0,0 +1,192 @@
+#include <stdio.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cores.h>
+#include <kcliques.h>
+
+static int numThreads(int threads) {
+#ifdef _OPENMP
+	return threads > 0 ? threads : omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+
+/*!
+ * \struct KCliqueSearch
+ * \brief State of the search for the cliques of a given size on one thread.
+ *
+ * The candidate set of level \c d of the search tree, whose vertices are adjacent to the \c d vertices of the current
+ * clique, is row \c d of \c P.
+ */
+typedef struct {
+	Graph * 	g; 				//!< Graph renumbered in reverse degeneracy order.
+	int 		k; 				//!< Size of the cliques.
+	BitMap * 	P; 				//!< Candidate sets, one per level.
+	int * 		C; 				//!< Current clique.
+	int * 		out; 			//!< Current clique in the original numbering, handed to the visitor.
+	int const * Rinv; 			//!< Original vertex of each vertex of \c g.
+	CliqueVisitor visit; 		//!< Function called with each clique, or \c NULL when counting.
+	void * 		data; 			//!< Pointer passed to \c visit.
+} KCliqueSearch;
+
+static int byVertex(const void * x, const void * y) {
+	return *((const int *) x) - *((const int *) y);
+}
+
+static void report(KCliqueSearch * ks) {
+	int i;
+
+	for (i = 0; i < ks->k; i++)
+		ks->out[i] = ks->Rinv[ks->C[i]];
+	qsort(ks->out, ks->k, sizeof(int), byVertex);
+#pragma omp critical (kcliqueVisit)
+	ks->visit(ks->out, ks->k, ks->data);
+}
+
+/*
+ * Number of edges of the subgraph induced by p.
+ */
+static long long edgesOf(Graph * g, BitMap const * p) {
+	BitMap row;
+	Node node;
+	long long m = 0;
+
+	setAsViewOf(g->matrix, &row);
+	for (begin(p, &node); !end(&node); next(&node)) {
+		subMap(g->matrix, &row, getElement(&node));
+		m += cardOfIntersection(&row, p);
+	}
+
+	return m >> 1;
+}
+
+/*
+ * Counts (or lists, if there is a visitor) the cliques with k vertices that extend the clique C[0..d-1] with
+ * vertices of row d of P.
+ */
+static long long expand(KCliqueSearch * ks, int d) {
+	BitMap p, pp, row;
+	Node node;
+	long long cnt = 0;
+	int v;
+
+	setAsViewOf(ks->P, &p);
+	subMap(ks->P, &p, d);
+	if (ks->visit == NULL) {
+		if (d == ks->k - 1)
+			return cardOf(&p);
+		if (d == ks->k - 2)
+			return edgesOf(ks->g, &p);
+	}
+	else if (d == ks->k - 1) {
+		for (begin(&p, &node); !end(&node); next(&node), cnt++) {
+			ks->C[d] = getElement(&node);
+			report(ks);
+		}
+		return cnt;
+	}
+
+	if (cardOf(&p) < ks->k - d)
+		return 0;
+
+	// each vertex is removed before its branch, so that the candidates of the next level are larger than it
+	setAsViewOf(ks->g->matrix, &row);
+	setAsViewOf(ks->P, &pp);
+	subMap(ks->P, &pp, d + 1);
+	for (begin(&p, &node); !end(&node); next(&node)) {
+		v = getElement(&node);
+		delElement(&p, v);
+		subMap(ks->g->matrix, &row, v);
+		intersectOf(&pp, &p, &row);
+		ks->C[d] = v;
+		cnt += expand(ks, d + 1);
+	}
+
+	return cnt;
+}
+
+/*
+ * Counts or lists the cliques with k >= 2 vertices.
+ */
+static long long search(Graph * gg, int k, CliqueVisitor visit, void * data, int threads) {
+	const int n = gg->n;
+	int * R = (int *) malloc(n * sizeof(int));
+	int * Rinv = (int *) malloc(n * sizeof(int));
+	Graph * g;
+	long long cnt = 0;
+	int i;
+
+	g = newDegeneracyRenumbered(gg, R);
+	for (i = 0; i < n; i++)
+		Rinv[R[i]] = i;
+
+	threads = numThreads(threads);
+#pragma omp parallel num_threads(threads) reduction(+:cnt)
+	{
+		KCliqueSearch ks;
+		BitMap p, row;
+		Node node;
+		int v, u;
+
+		ks.g = g;
+		ks.k = k;
+		ks.P = newBitMapVector(k, n);
+		ks.C = (int *) malloc(k * sizeof(int));
+		ks.out = (int *) malloc(k * sizeof(int));
+		ks.Rinv = Rinv;
+		ks.visit = visit;
+		ks.data = data;
+		setAsViewOf(ks.P, &p);
+		subMap(ks.P, &p, 1);
+		setAsViewOf(g->matrix, &row);
+
+		// the candidates of v are its neighbors removed after it in the core decomposition, which are smaller than v
+#pragma omp for schedule(dynamic, 1)
+		for (v = n - 1; v >= 0; v--) {
+			subMap(g->matrix, &row, v);
+			delAllElements(&p);
+			for (begin(&row, &node); !end(&node) && (u = getElement(&node)) < v; next(&node))
+				addElement(&p, u);
+			ks.C[0] = v;
+			cnt += expand(&ks, 1);
+		}
+
+		freeBitMap(ks.P);
+		free(ks.C);
+		free(ks.out);
+	}
+
+	delGraph(g);
+	free(g);
+	free(R);
+	free(Rinv);
+
+	return cnt;
+}
+
+long long countKCliques(Graph * g, int k, int threads) {
+	if (k <= 0)
+		return 1;
+	if (k == 1)
+		return g->n;
+	if (g->n == 0)
+		return 0;
+	return search(g, k, NULL, NULL, threads);
+}
+
+long long listKCliques(Graph * g, int k, CliqueVisitor visit, void * data, int threads) {
+	int v;
+
+	if (k <= 0 || g->n == 0)
+		return 0;
+	if (k == 1) {
+		for (v = 0; v < g->n; v++)
+			visit(&v, 1, data);
+		return g->n;
+	}
+	return search(g, k, visit, data, threads);
+}
@@ -0,0 +1,53 @@
+/*!
+ * \file kcliques.h
+ *
+ * \date Oct 18, 2026
+ * \author Ricardo C. Corrêa (correa@ufrrj.br)
+ *
+ * \brief Counting and listing of the cliques of a given size of graphs.
+ *
+ * The graph is renumbered with #newDegeneracyRenumbered, and each clique is found from its largest vertex \c v, whose
+ * candidates are its smaller neighbors (at most the degeneracy of the graph). The candidate set of each level of the
+ * search is the intersection of the candidate set of the previous level with a row of the adjacency matrix, stored
+ * in a row of a bitmap vector allocated once per thread, so that nothing is allocated during the search.
+ *
+ * When counting, the search stops two levels before the size of the cliques: the number of cliques of a candidate set
+ * with one more vertex is its number of bits, and with two more vertices it is its number of edges, that is, half of the
+ * sum of the number of bits of its intersections with the rows of its vertices. The outer vertices are distributed to the threads.
+ */
+#ifndef KCLIQUES_H_
+#define KCLIQUES_H_
+
+#include <graph.h>
+#include <maximal.h>
+
+/*!
+ * \fn long long countKCliques(Graph * g, int k, int threads)
+ * \brief Counts the cliques with a specified number of vertices of a graph.
+ *
+ * \param g The graph.
+ * \param k The number of vertices of the cliques.
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ *
+ * \return The number of cliques of \c g with \c k vertices (1 for \c k = 0).
+ */
+long long countKCliques(Graph * g, int k, int threads);
+
+/*!
+ * \fn long long listKCliques(Graph * g, int k, CliqueVisitor visit, void * data, int threads)
+ * \brief Lists the cliques with a specified number of vertices of a graph.
+ *
+ * Each clique is handed to \c visit as soon as it is found, as in #maximalCliques: the vertices are in increasing
+ * order and the calls are made inside a critical section.
+ *
+ * \param g The graph.
+ * \param k The number of vertices of the cliques, at least 1.
+ * \param visit The function called with each clique.
+ * \param data Pointer passed to \c visit.
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ *
+ * \return The number of cliques of \c g with \c k vertices.
+ */
+long long listKCliques(Graph * g, int k, CliqueVisitor visit, void * data, int threads);
+
+#endif /* KCLIQUES_H_ */
@@ -0,0 +1,212 @@
+#include <stdio.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cores.h>
+#include <maximal.h>
+
+static int numThreads(int threads) {
+#ifdef _OPENMP
+	return threads > 0 ? threads : omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+
+/*!
+ * \struct MaximalSearch
+ * \brief State of the enumeration of the maximal cliques on one thread.
+ *
+ * The sets of level \c d of the search tree are row \c d of \c P, \c X and \c B. A level is at most one more than the
+ * degeneracy of the graph.
+ */
+typedef struct {
+	Graph * 	g; 				//!< Graph renumbered in reverse degeneracy order.
+	BitMap * 	P; 				//!< Vertices that extend the current clique, per level.
+	BitMap * 	X; 				//!< Vertices that extend the current clique, but whose cliques were already enumerated, per level.
+	BitMap * 	B; 				//!< Vertices of \c P to branch on (not adjacent to the pivot), per level.
+	int * 		C; 				//!< Current clique.
+	int * 		out; 			//!< Current clique in the original numbering, handed to the visitor.
+	int const * Rinv; 			//!< Original vertex of each vertex of \c g.
+	int 		minsize; 		//!< Smallest size of a clique to enumerate.
+	CliqueVisitor visit; 		//!< Function called with each clique, or \c NULL.
+	void * 		data; 			//!< Pointer passed to \c visit.
+	long long 	cnt; 			//!< Number of cliques found by this thread.
+} MaximalSearch;
+
+static int byVertex(const void * x, const void * y) {
+	return *((const int *) x) - *((const int *) y);
+}
+
+static void report(MaximalSearch * ms, int k) {
+	int i;
+
+	ms->cnt++;
+	if (ms->visit == NULL)
+		return;
+	for (i = 0; i < k; i++)
+		ms->out[i] = ms->Rinv[ms->C[i]];
+	qsort(ms->out, k, sizeof(int), byVertex);
+#pragma omp critical (maximalVisit)
+	ms->visit(ms->out, k, ms->data);
+}
+
+/*
+ * Vertex of P U X with the most neighbors in P. Stops at a vertex adjacent to all the other vertices of P.
+ */
+static int pivot(MaximalSearch * ms, BitMap const * p, BitMap const * x, int np) {
+	BitMap row;
+	Node node;
+	int u, c, best = -1, cbest = -1;
+
+	setAsViewOf(ms->g->matrix, &row);
+	for (begin(p, &node); !end(&node) && cbest < np - 1; next(&node)) {
+		u = getElement(&node);
+		subMap(ms->g->matrix, &row, u);
+		if ((c = cardOfIntersection(&row, p)) > cbest) {
+			cbest = c;
+			best = u;
+		}
+	}
+	for (begin(x, &node); !end(&node) && cbest < np; next(&node)) {
+		u = getElement(&node);
+		subMap(ms->g->matrix, &row, u);
+		if ((c = cardOfIntersection(&row, p)) > cbest) {
+			cbest = c;
+			best = u;
+		}
+	}
+
+	return best;
+}
+
+/*
+ * Extends the clique C[0..d-1] with the vertices of row d of P, excluding the cliques that contain a vertex of row d of X.
+ */
+static void expand(MaximalSearch * ms, int d) {
+	BitMap p, x, b, pp, xx, row;
+	Node node;
+	int v, np;
+
+	setAsViewOf(ms->P, &p);
+	subMap(ms->P, &p, d);
+	setAsViewOf(ms->X, &x);
+	subMap(ms->X, &x, d);
+
+	np = cardOf(&p);
+	if (np == 0) {
+		if (!isNotEmpty(&x) && d >= ms->minsize)
+			report(ms, d);
+		return;
+	}
+	if (d + np < ms->minsize)
+		return;
+
+	// the branches are the vertices of P not adjacent to the pivot
+	setAsViewOf(ms->g->matrix, &row);
+	subMap(ms->g->matrix, &row, pivot(ms, &p, &x, np));
+	setAsViewOf(ms->B, &b);
+	subMap(ms->B, &b, d);
+	copyAll(&b, &p);
+	removeAll(&b, &row);
+
+	setAsViewOf(ms->P, &pp);
+	subMap(ms->P, &pp, d + 1);
+	setAsViewOf(ms->X, &xx);
+	subMap(ms->X, &xx, d + 1);
+	for (begin(&b, &node); !end(&node); next(&node)) {
+		v = getElement(&node);
+		subMap(ms->g->matrix, &row, v);
+		intersectOf(&pp, &p, &row);
+		intersectOf(&xx, &x, &row);
+		ms->C[d] = v;
+		expand(ms, d + 1);
+		delElement(&p, v);
+		addElement(&x, v);
+		if (d + --np < ms->minsize)
+			break;
+	}
+}
+
+long long maximalCliques(Graph * gg, int minsize, CliqueVisitor visit, void * data, int threads) {
+	const int n = gg->n;
+	int * R;
+	int * Rinv;
+	Graph * g;
+	long long cnt = 0;
+	int i, degeneracy;
+
+	if (n == 0)
+		return 0;
+
+	R = (int *) malloc(n * sizeof(int));
+	Rinv = (int *) malloc(n * sizeof(int));
+	g = newDegeneracyRenumbered(gg, R);
+	for (i = 0; i < n; i++)
+		Rinv[R[i]] = i;
+	degeneracy = coreDecomposition(g, NULL, NULL);
+
+	threads = numThreads(threads);
+#pragma omp parallel num_threads(threads) reduction(+:cnt)
+	{
+		MaximalSearch ms;
+		BitMap p, x, row;
+		Node node;
+		int v, u;
+
+		ms.g = g;
+		ms.P = newBitMapVector(degeneracy + 2, n);
+		ms.X = newBitMapVector(degeneracy + 2, n);
+		ms.B = newBitMapVector(degeneracy + 2, n);
+		ms.C = (int *) malloc((degeneracy + 1) * sizeof(int));
+		ms.out = (int *) malloc((degeneracy + 1) * sizeof(int));
+		ms.Rinv = Rinv;
+		ms.minsize = minsize;
+		ms.visit = visit;
+		ms.data = data;
+		ms.cnt = 0;
+		setAsViewOf(ms.P, &p);
+		setAsViewOf(ms.X, &x);
+		setAsViewOf(g->matrix, &row);
+
+		// vertex v is removed after the vertices larger than it, so that its clique is extended only with the smaller ones
+#pragma omp for schedule(dynamic, 1)
+		for (v = n - 1; v >= 0; v--) {
+			subMap(g->matrix, &row, v);
+			subMap(ms.P, &p, 1);
+			subMap(ms.X, &x, 1);
+			delAllElements(&p);
+			for (begin(&row, &node); !end(&node) && (u = getElement(&node)) < v; next(&node))
+				addElement(&p, u);
+			copyAll(&x, &row);
+			removeAll(&x, &p);
+			ms.C[0] = v;
+			expand(&ms, 1);
+		}
+		cnt += ms.cnt;
+
+		freeBitMap(ms.P);
+		freeBitMap(ms.X);
+		freeBitMap(ms.B);
+		free(ms.C);
+		free(ms.out);
+	}
+
+	delGraph(g);
+	free(g);
+	free(R);
+	free(Rinv);
+
+	return cnt;
+}
+
+long long countMaximalCliques(Graph * g, int minsize, int threads) {
+	return maximalCliques(g, minsize, NULL, NULL, threads);
+}
+
+void writeClique(int const * C, int k, void * file) {
+	fwrite(&k, sizeof(int), 1, (FILE *) file);
+	fwrite(C, sizeof(int), k, (FILE *) file);
+}
@@ -0,0 +1,83 @@
+/*!
+ * \file maximal.h
+ *
+ * \date Oct 18, 2026
+ * \author Ricardo C. Corrêa (correa@ufrrj.br)
+ *
+ * \brief Enumeration of the maximal cliques of graphs.
+ *
+ * The enumeration is the algorithm of Bron and Kerbosch with the pivoting rule of Tomita et al., where the sets \c P
+ * (vertices that extend the current clique) and \c X (vertices that extend it, but were already tried) of each level
+ * are #BitMap rows of preallocated vectors. The pivot is the vertex of \f$P \cup X\f$ with the most neighbors in \c P,
+ * and only the vertices of \c P not adjacent to it are branched on.
+ *
+ * The outer loop follows a degeneracy order, as in Eppstein, Löffler and Strash: the graph is renumbered with
+ * #newDegeneracyRenumbered, and the clique of each vertex \c v is extended only with its neighbors removed after it in
+ * the core decomposition (at most the degeneracy of the graph), the other neighbors being put in \c X. The outer
+ * vertices are distributed to the threads.
+ *
+ * The cliques are not stored: each one is handed to a function as soon as it is found, or only counted.
+ */
+#ifndef MAXIMAL_H_
+#define MAXIMAL_H_
+
+#include <stdio.h>
+
+#include <graph.h>
+
+/*!
+ * \typedef CliqueVisitor
+ * \brief Function that receives each clique found by #maximalCliques.
+ *
+ * \param C The vertices of the clique, in increasing order (the array is reused after the call returns).
+ * \param k The size of the clique.
+ * \param data The pointer passed to #maximalCliques.
+ */
+typedef void (*CliqueVisitor)(int const * C, int k, void * data);
+
+/*!
+ * \fn long long maximalCliques(Graph * g, int minsize, CliqueVisitor visit, void * data, int threads)
+ * \brief Enumerates the maximal cliques of a specified graph with at least a specified number of vertices.
+ *
+ * A branch is cut as soon as the current clique together with \c P has less than \c minsize vertices. The calls of
+ * \c visit are made inside a critical section, so that \c visit need not be thread-safe, but the order of the cliques
+ * depends on the scheduling of the threads.
+ *
+ * \param g The graph.
+ * \param minsize The smallest size of a clique to enumerate.
+ * \param visit The function called with each clique, or \c NULL to count the cliques only.
+ * \param data Pointer passed to \c visit.
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ *
+ * \return The number of maximal cliques of \c g with at least \c minsize vertices.
+ */
+long long maximalCliques(Graph * g, int minsize, CliqueVisitor visit, void * data, int threads);
+
+/*!
+ * \fn long long countMaximalCliques(Graph * g, int minsize, int threads)
+ * \brief Counts the maximal cliques of a specified graph with at least a specified number of vertices.
+ *
+ * Same as #maximalCliques, without visiting the cliques.
+ *
+ * \param g The graph.
+ * \param minsize The smallest size of a clique to count.
+ * \param threads The number of threads, or 0 for the OpenMP default.
+ *
+ * \return The number of maximal cliques of \c g with at least \c minsize vertices.
+ */
+long long countMaximalCliques(Graph * g, int minsize, int threads);
+
+/*!
+ * \fn void writeClique(int const * C, int k, void * file)
+ * \brief Writes a clique to a binary stream, as a #CliqueVisitor of #maximalCliques.
+ *
+ * The clique is written as \c k + 1 values of type \c int, in the byte order of the host: \c k, followed by the vertices
+ * of the clique.
+ *
+ * \param C The vertices of the clique.
+ * \param k The size of the clique.
+ * \param file The stream (a \c FILE * opened for writing in binary mode).
+ */
+void writeClique(int const * C, int k, void * file);
+
+#endif /* MAXIMAL_H_ */
@@ -0,0 +1,307 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <reduction.h>
+
+/*!
+ * \struct HashedVertex
+ * \brief A vertex with the hash of its row, sorted by hash to find the twins.
+ */
+typedef struct {
+	unsigned long long hash; 	//!< Hash of the row.
+	int 		v; 				//!< Vertex.
+} HashedVertex;
+
+/*!
+ * \struct Reducer
+ * \brief State of a reduction: the graph induced by the remaining vertices, with their degrees and weights.
+ */
+typedef struct {
+	int 		n; 				//!< Number of vertices of the original graph.
+	Graph * 	g; 				//!< Copy of the graph, whose removed vertices are isolated.
+	Degrees * 	d; 				//!< Degrees of \c g, updated as the vertices are removed.
+	BitMap * 	alive; 			//!< Remaining vertices.
+	BitMap * 	a; 				//!< Scratch bitmap.
+	BitMap * 	b; 				//!< Scratch bitmap.
+	double * 	w; 				//!< Weight of each remaining vertex.
+	HashedVertex * order; 		//!< Remaining vertices sorted by the hashes of their rows.
+	Reduction * red; 			//!< The reduction built.
+} Reducer;
+
+static int byHash(const void * x, const void * y) {
+	const HashedVertex * a = (const HashedVertex *) x;
+	const HashedVertex * b = (const HashedVertex *) y;
+	return a->hash != b->hash ? (a->hash < b->hash ? -1 : 1) : a->v - b->v;
+}
+
+/*
+ * Hash of the word w at index k of a row (the finalizer of splitmix64). The hash of a row is the sum of the hashes of
+ * its words, so that setting one bit changes only one term.
+ */
+static inline unsigned long long wordHash(MAPWORD w, int k) {
+	unsigned long long x = (unsigned long long) w + 0x9e3779b97f4a7c15ULL * (k + 1);
+
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+	return x ^ (x >> 31);
+}
+
+/*
+ * Hash of the row of u, with the bit of u set if closed is nonzero.
+ */
+static unsigned long long hashOf(Reducer * rd, int u, int closed) {
+	BitMap row;
+	MAPWORD const * mw;
+	unsigned long long h = 0;
+	int k, mn;
+
+	setAsViewOf(rd->g->matrix, &row);
+	subMap(rd->g->matrix, &row, u);
+	mw = (MAPWORD const *) row.R;
+	mn = row.nRnodes << (LOGB - LOGMAPWORD);
+	for (k = 0; k < mn; k++)
+		h += wordHash(mw[k], k);
+	if (closed) {
+		k = u >> LOGMAPWORD;
+		h += wordHash(mw[k] | ((MAPWORD) 1 << (u & ((1 << LOGMAPWORD) - 1))), k) - wordHash(mw[k], k);
+	}
+
+	return h;
+}
+
+/*
+ * Removes u from the graph, recording that it is dominated by v or merged into v.
+ */
+static void removeVertex(Reducer * rd, int u, int v, int merged) {
+	Reduction * red = rd->red;
+	BitMap row;
+	Node node;
+
+	setAsViewOf(rd->g->matrix, &row);
+	subMap(rd->g->matrix, &row, u);
+	for (begin(&row, &node); !end(&node); next(&node))
+		delEdgeDeg(rd->g, rd->d, u, getElement(&node));
+	delElement(rd->alive, u);
+	if (merged)
+		rd->w[v] += rd->w[u];
+
+	red->removed[red->nremoved] = u;
+	red->by[red->nremoved] = v;
+	red->merged[red->nremoved++] = merged;
+}
+
+/*
+ * Finds the twins among the remaining vertices, closed neighborhoods if closed is nonzero and open ones otherwise.
+ * Of each pair, the lighter one is removed (merged into the other one, for true twins). Returns the number of removals.
+ */
+static int twins(Reducer * rd, int closed) {
+	BitMap ru, rv;
+	Node node;
+	int i, j, l, t, u, v, no = 0, cnt = 0;
+
+	for (begin(rd->alive, &node); !end(&node); next(&node)) {
+		u = getElement(&node);
+		rd->order[no].hash = hashOf(rd, u, closed);
+		rd->order[no++].v = u;
+	}
+	qsort(rd->order, no, sizeof(HashedVertex), byHash);
+
+	setAsViewOf(rd->g->matrix, &ru);
+	setAsViewOf(rd->g->matrix, &rv);
+	for (i = 0; i < no; i = l) {
+		for (l = i + 1; l < no && rd->order[l].hash == rd->order[i].hash; l++)
+			;
+		// vertices of equal hashes, compared with the other remaining ones of the run
+		for (j = i; j < l; j++) {
+			u = rd->order[j].v;
+			if (!hasElement(rd->alive, u))
+				continue;
+			for (t = j + 1; t < l && hasElement(rd->alive, u); t++) {
+				v = rd->order[t].v;
+				if (!hasElement(rd->alive, v) || rd->d->deg[u] != rd->d->deg[v])
+					continue;
+				subMap(rd->g->matrix, &ru, u);
+				subMap(rd->g->matrix, &rv, v);
+				if (closed) {
+					if (!hasElement(&ru, v))
+						continue;
+					copyAll(rd->a, &ru);
+					addElement(rd->a, u);
+					copyAll(rd->b, &rv);
+					addElement(rd->b, v);
+					if (!areEqual(rd->a, rd->b))
+						continue;
+				}
+				else if (!areEqual(&ru, &rv))
+					continue;
+				if (rd->w[v] <= rd->w[u])
+					removeVertex(rd, v, u, closed);
+				else
+					removeVertex(rd, u, v, closed);
+				cnt++;
+			}
+		}
+	}
+
+	return cnt;
+}
+
+/*
+ * Removes the remaining vertices dominated by a nonadjacent vertex at least as heavy. Returns the number of removals.
+ */
+static int dominance(Reducer * rd) {
+	BitMap ru, rv;
+	Node node, nx;
+	int u, v, x, y, cnt = 0;
+
+	setAsViewOf(rd->g->matrix, &ru);
+	setAsViewOf(rd->g->matrix, &rv);
+	for (begin(rd->alive, &node); !end(&node); next(&node)) {
+		u = getElement(&node);
+		subMap(rd->g->matrix, &ru, u);
+
+		// the vertices that dominate u are the neighbors of each neighbor of u, and any vertex if u is isolated
+		x = -1;
+		for (begin(&ru, &nx); !end(&nx); next(&nx)) {
+			y = getElement(&nx);
+			if (x < 0 || rd->d->deg[y] < rd->d->deg[x])
+				x = y;
+		}
+		if (x >= 0) {
+			subMap(rd->g->matrix, &rv, x);
+			copyAll(rd->a, &rv);
+			removeAll(rd->a, &ru);
+		}
+		else
+			copyAll(rd->a, rd->alive);
+		delElement(rd->a, u);
+
+		for (begin(rd->a, &nx); !end(&nx); next(&nx)) {
+			v = getElement(&nx);
+			if (rd->d->deg[v] < rd->d->deg[u] || rd->w[v] < rd->w[u])
+				continue;
+			subMap(rd->g->matrix, &rv, v);
+			if (isSubset(&ru, &rv)) {
+				removeVertex(rd, u, v, 0);
+				cnt++;
+				break;
+			}
+		}
+	}
+
+	return cnt;
+}
+
+static Reduction * newReduction(Graph * g, int clique) {
+	const int n = g->n;
+	Reduction * red = (Reduction *) malloc(sizeof(Reduction));
+	Reducer rd;
+	BitMap row, src;
+	Node node, nv;
+	int * map = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	int u, v, nr;
+
+	red->n = n;
+	red->nremoved = 0;
+	red->removed = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	red->by = (int *) malloc((n > 0 ? n : 1) * sizeof(int));
+	red->merged = (char *) malloc((n > 0 ? n : 1) * sizeof(char));
+
+	rd.n = n;
+	rd.red = red;
+	rd.g = newGraph(n > 0 ? n : 1);
+	rd.alive = newBitMap(n > 0 ? n : 1);
+	rd.a = newBitMap(n > 0 ? n : 1);
+	rd.b = newBitMap(n > 0 ? n : 1);
+	rd.w = (double *) malloc((n > 0 ? n : 1) * sizeof(double));
+	rd.order = (HashedVertex *) malloc((n > 0 ? n : 1) * sizeof(HashedVertex));
+
+	setAsViewOf(rd.g->matrix, &row);
+	setAsViewOf(g->matrix, &src);
+	for (u = 0; u < n; u++) {
+		subMap(rd.g->matrix, &row, u);
+		subMap(g->matrix, &src, u);
+		copyAll(&row, &src);
+		rd.w[u] = 1.0;
+		addElement(rd.alive, u);
+	}
+	// the rows are copied in bulk, and g may come from the prebuilt main library, so the edges are recounted
+	countEdges(rd.g);
+	rd.d = newDegrees(rd.g);
+
+	// true twins are merged only in the clique reduction, and false twins are also found by the dominance test
+	while ((clique ? twins(&rd, 1) : 0) + twins(&rd, 0) + dominance(&rd) > 0)
+		;
+
+	// the reduced graph, on the remaining vertices in increasing order
+	nr = n - red->nremoved;
+	red->g = newGraph(nr);
+	red->orig = (int *) malloc((nr > 0 ? nr : 1) * sizeof(int));
+	red->w = (double *) malloc((nr > 0 ? nr : 1) * sizeof(double));
+	for (nr = 0, begin(rd.alive, &node); !end(&node); next(&node), nr++) {
+		u = getElement(&node);
+		map[u] = nr;
+		red->orig[nr] = u;
+		red->w[nr] = rd.w[u];
+	}
+	for (begin(rd.alive, &node); !end(&node); next(&node)) {
+		u = getElement(&node);
+		subMap(rd.g->matrix, &row, u);
+		for (begin(&row, &nv); !end(&nv) && (v = getElement(&nv)) < u; next(&nv))
+			addEdge(red->g, map[u], map[v]);
+	}
+
+	delDegrees(rd.d);
+	delGraph(rd.g);
+	free(rd.g);
+	freeBitMap(rd.alive);
+	freeBitMap(rd.a);
+	freeBitMap(rd.b);
+	free(rd.w);
+	free(rd.order);
+	free(map);
+
+	return red;
+}
+
+Reduction * reduceForClique(Graph * g) {
+	return newReduction(g, 1);
+}
+
+Reduction * reduceForColoring(Graph * g) {
+	return newReduction(g, 0);
+}
+
+BitMap * liftClique(Reduction const * red, BitMap const * c) {
+	BitMap * ret = newBitMap(red->n > 0 ? red->n : 1);
+	Node node;
+	int t;
+
+	for (begin(c, &node); !end(&node); next(&node))
+		addElement(ret, red->orig[getElement(&node)]);
+	for (t = red->nremoved - 1; t >= 0; t--)
+		if (red->merged[t] && hasElement(ret, red->by[t]))
+			addElement(ret, red->removed[t]);
+
+	return ret;
+}
+
+void liftColoring(Reduction const * red, int const * color, int * lifted) {
+	int i, t;
+
+	for (i = 0; i < red->g->n; i++)
+		lifted[red->orig[i]] = color[i];
+	for (t = red->nremoved - 1; t >= 0; t--)
+		lifted[red->removed[t]] = lifted[red->by[t]];
+}
+
+void delReduction(Reduction * red) {
+	delGraph(red->g);
+	free(red->g);
+	free(red->orig);
+	free(red->w);
+	free(red->removed);
+	free(red->by);
+	free(red->merged);
+	free(red);
+}
@@ -0,0 +1,109 @@
+/*!
+ * \file reduction.h
+ *
+ * \date Oct 18, 2026
+ * \author Ricardo C. Corrêa (correa@ufrrj.br)
+ *
+ * \brief Twin and dominance reductions of graphs, as a preprocessing for clique and coloring algorithms.
+ *
+ * Two vertices \c u and \c v are false twins if \f$N(u) = N(v)\f$, and true twins if \f$N[u] = N[v]\f$, where
+ * \f$N[u] = N(u) \cup \{u\}\f$. A vertex \c u is dominated by a vertex \c v not adjacent to it if
+ * \f$N(u) \subseteq N(v)\f$, so that false twins dominate each other. Then:
+ *
+ * - a dominated vertex can be removed in the search of a maximum clique, since \c v replaces \c u in every clique with
+ *   \c u, and in coloring, since \c u can receive the color of \c v;
+ * - true twins are in the same maximal cliques, so that, in the search of a maximum clique, \c u can be merged
+ *   into \c v, whose weight becomes the sum of their weights.
+ *
+ * A vertex adjacent to the one that dominates it (\f$N(u) \setminus \{v\} \subseteq N(v)\f$) cannot be removed in
+ * either problem, so only the nonadjacent case is used.
+ *
+ * The twins are found by hashing the words of the rows of the adjacency matrix (with the bit of the vertex set, for
+ * true twins), sorting the vertices by hash and comparing the rows of equal hashes with #areEqual. A vertex is tested
+ * for dominance with #isSubset against the neighbors of its neighbor of smallest degree, the only vertices that can
+ * dominate it. Each removal may create new twins or dominances, so both tests are repeated until nothing changes.
+ *
+ * The reduced graph comes with the data to lift its solutions back to the original graph, with #liftClique and #liftColoring.
+ */
+#ifndef REDUCTION_H_
+#define REDUCTION_H_
+
+#include <graph.h>
+
+/*!
+ * \struct Reduction
+ * \brief A reduced graph, with the data to lift its solutions back to the original graph.
+ */
+typedef struct {
+	Graph * 	g; 				//!< Reduced graph, whose vertices are the remaining vertices of the original graph, in increasing order.
+	int 		n; 				//!< Number of vertices of the original graph.
+	int * 		orig; 			//!< Original vertex of each vertex of the reduced graph.
+	double * 	w; 				//!< Weight of each vertex of the reduced graph, that is, the number of vertices of the original graph merged into it.
+	int 		nremoved; 		//!< Number of removed vertices.
+	int * 		removed; 		//!< Removed vertices, in the order of removal.
+	int * 		by; 			//!< Vertex that dominates each removed vertex, or into which it was merged, when it was removed.
+	char * 		merged; 		//!< Nonzero for each removed vertex merged into a true twin, and 0 for each dominated one.
+} Reduction;
+
+/*!
+ * \fn Reduction * reduceForClique(Graph * g)
+ * \brief Reduces a specified graph for the search of a maximum clique.
+ *
+ * True twins are merged and dominated vertices are removed, where a vertex is removed only if it is not heavier than the
+ * one that dominates it. If no true twins are merged, all the weights are 1 and a maximum clique of the reduced graph
+ * (found with #maxClique, for instance) lifts to a maximum clique of \c g; otherwise, a maximum weight clique of the
+ * reduced graph with weights \c w (found with #maxIntWeightClique) does.
+ *
+ * \param g The graph.
+ *
+ * \return The reduction.
+ */
+Reduction * reduceForClique(Graph * g);
+
+/*!
+ * \fn Reduction * reduceForColoring(Graph * g)
+ * \brief Reduces a specified graph for vertex coloring.
+ *
+ * Dominated vertices are removed, so that every coloring of the reduced graph lifts to a coloring of \c g with the
+ * same number of colors, and the chromatic numbers of both graphs are equal. All the weights are 1.
+ *
+ * \param g The graph.
+ *
+ * \return The reduction.
+ */
+Reduction * reduceForColoring(Graph * g);
+
+/*!
+ * \fn BitMap * liftClique(Reduction const * red, BitMap const * c)
+ * \brief Lifts a clique of a reduced graph to a clique of the original graph.
+ *
+ * The clique is mapped to the original vertices, and the vertices merged into them are added, in the reverse order of the merges.
+ *
+ * \param red The reduction.
+ * \param c A clique of \c red->g.
+ *
+ * \return A new bitmap with the vertices of the lifted clique, whose size is the weight of \c c.
+ */
+BitMap * liftClique(Reduction const * red, BitMap const * c);
+
+/*!
+ * \fn void liftColoring(Reduction const * red, int const * color, int * lifted)
+ * \brief Lifts a coloring of a graph reduced by #reduceForColoring to a coloring of the original graph.
+ *
+ * Each removed vertex receives the color of the vertex that dominated it, in the reverse order of the removals.
+ *
+ * \param red The reduction.
+ * \param color The color of each vertex of \c red->g (the array \c color of a #Coloring, for instance).
+ * \param lifted Array of size \c red->n where the color of each vertex of the original graph is stored.
+ */
+void liftColoring(Reduction const * red, int const * color, int * lifted);
+
+/*!
+ * \fn void delReduction(Reduction * red)
+ * \brief Deletes a specified reduction, including its reduced graph.
+ *
+ * \param red The reduction.
+ */
+void delReduction(Reduction * red);
+
+#endif /* REDUCTION_H_ */
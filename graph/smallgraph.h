@@ -0,0 +1,192 @@
+/*!
+ * \file smallgraph.h
+ *
+ * \date Oct 18, 2026
+ * \author Ricardo C. Corrêa (correa@ufrrj.br)
+ *
+ * \brief Fixed size bitmap implementations of graphs with at most 64, 128 or 256 vertices.
+ *
+ * A graph with \c n vertices is stored as a #Graph whatever the value of \c n, and every operation on its rows
+ * pays for the generic #BitMap layout (variable number of nodes, \c subMap views, loop bounds stored in memory).
+ * For small graphs, this header defines specialized types in which a whole set fits in 1, 2 or 4 64-bit words,
+ * so that the number of words is a compile-time constant and the kernels (intersection, counting, enumeration)
+ * compile to straight-line code kept in registers (SSE or AVX registers when enabled in the \c gcc command line).
+ *
+ * For each size \c N in { 64, 128, 256 }, the following types and functions are defined:
+ *
+ * - \c SmallSetN: set of integers in { 0, ..., N-1 };
+ * - \c SmallGraphN: adjacency matrix of a graph with at most \c N vertices, with one \c SmallSetN per row;
+ * - \c newSmallGraphN(g) and \c delSmallGraphN(sg): creation from a #Graph and deletion;
+ * - \c smallNeigN(sg, i): neighborhood of \c i;
+ * - \c smallClearN, \c smallFillN, \c smallAddN, \c smallDelN, \c smallHasN: element manipulation;
+ * - \c smallAndN, \c smallAndNotN, \c smallOrN: set operations with the result in the first argument;
+ * - \c smallCardN, \c smallCardAndN, \c smallIsEmptyN: counting;
+ * - \c smallFirstN, \c smallNextN: forward enumeration, as in
+ *   \code{.c}
+     for (i = smallFirst64(&s); i >= 0; i = smallNext64(&s, i))
+   \endcode
+ * - \c smallFromBitMapN, \c smallToBitMapN: conversion from and to #BitMap.
+ *
+ * The size to use for a graph is chosen with #smallGraphSize when a solver is called, since the #Graph read by the
+ * prebuilt main library cannot carry it: #maxClique and #greedyColoring run on these types whenever there are at
+ * most 256 vertices.
+ */
+
+#ifndef SMALLGRAPH_H_
+#define SMALLGRAPH_H_
+
+#include <stdint.h>
+
+#include <graph.h>
+
+/*!
+ * \fn int smallGraphSize(size_t n)
+ * \brief Determines the specialized size for a graph with a specified number of vertices.
+ *
+ * \param n The number of vertices.
+ *
+ * \return 64, 128 or 256 as the smallest of the specialized sizes not smaller than \c n, or 0 if \c n is greater than 256.
+ */
+static inline int smallGraphSize(size_t n) {
+	if (n <= 64)
+		return 64;
+	if (n <= 128)
+		return 128;
+	if (n <= 256)
+		return 256;
+	return 0;
+}
+
+#define SMALLGRAPH_DEFINE(N, W) \
+\
+typedef struct { \
+	uint64_t w[W]; \
+} __attribute__((aligned(8*W))) SmallSet##N; \
+\
+typedef struct { \
+	int n; \
+	SmallSet##N row[N]; \
+} SmallGraph##N; \
+\
+static inline void smallClear##N(SmallSet##N * s) { \
+	int k; \
+	for (k = 0; k < W; k++) \
+		s->w[k] = 0; \
+} \
+\
+static inline void smallFill##N(SmallSet##N * s, int n) { \
+	int k; \
+	for (k = 0; k < W; k++) \
+		s->w[k] = n >= ((k + 1) << 6) ? ~0ULL : n <= (k << 6) ? 0ULL : ~0ULL >> (64 - (n & 63)); \
+} \
+\
+static inline void smallAdd##N(SmallSet##N * s, int i) { \
+	s->w[i >> 6] |= 1ULL << (i & 63); \
+} \
+\
+static inline void smallDel##N(SmallSet##N * s, int i) { \
+	s->w[i >> 6] &= ~(1ULL << (i & 63)); \
+} \
+\
+static inline int smallHas##N(SmallSet##N const * s, int i) { \
+	return (s->w[i >> 6] >> (i & 63)) & 1; \
+} \
+\
+static inline void smallAnd##N(SmallSet##N * r, SmallSet##N const * a, SmallSet##N const * b) { \
+	int k; \
+	for (k = 0; k < W; k++) \
+		r->w[k] = a->w[k] & b->w[k]; \
+} \
+\
+static inline void smallAndNot##N(SmallSet##N * r, SmallSet##N const * a, SmallSet##N const * b) { \
+	int k; \
+	for (k = 0; k < W; k++) \
+		r->w[k] = a->w[k] & ~b->w[k]; \
+} \
+\
+static inline void smallOr##N(SmallSet##N * r, SmallSet##N const * a, SmallSet##N const * b) { \
+	int k; \
+	for (k = 0; k < W; k++) \
+		r->w[k] = a->w[k] | b->w[k]; \
+} \
+\
+static inline int smallCard##N(SmallSet##N const * s) { \
+	int k, c = 0; \
+	for (k = 0; k < W; k++) \
+		c += __builtin_popcountll(s->w[k]); \
+	return c; \
+} \
+\
+static inline int smallCardAnd##N(SmallSet##N const * a, SmallSet##N const * b) { \
+	int k, c = 0; \
+	for (k = 0; k < W; k++) \
+		c += __builtin_popcountll(a->w[k] & b->w[k]); \
+	return c; \
+} \
+\
+static inline int smallIsEmpty##N(SmallSet##N const * s) { \
+	uint64_t o = 0; \
+	int k; \
+	for (k = 0; k < W; k++) \
+		o |= s->w[k]; \
+	return o == 0; \
+} \
+\
+static inline int smallFirst##N(SmallSet##N const * s) { \
+	int k; \
+	for (k = 0; k < W; k++) \
+		if (s->w[k] != 0) \
+			return (k << 6) + __builtin_ctzll(s->w[k]); \
+	return -1; \
+} \
+\
+static inline int smallNext##N(SmallSet##N const * s, int i) { \
+	int k = ++i >> 6; \
+	uint64_t x; \
+	if (k >= W) \
+		return -1; \
+	x = s->w[k] & (~0ULL << (i & 63)); \
+	while (x == 0) { \
+		if (++k >= W) \
+			return -1; \
+		x = s->w[k]; \
+	} \
+	return (k << 6) + __builtin_ctzll(x); \
+} \
+\
+static inline void smallFromBitMap##N(SmallSet##N * s, BitMap const * b) { \
+	size_t sz = b->nRnodes << LOGW; \
+	smallClear##N(s); \
+	memcpy(s->w, b->R, sz < sizeof(s->w) ? sz : sizeof(s->w)); \
+} \
+\
+static inline void smallToBitMap##N(BitMap * b, SmallSet##N const * s) { \
+	size_t sz = b->nRnodes << LOGW; \
+	delAllElements(b); \
+	memcpy(b->R, s->w, sz < sizeof(s->w) ? sz : sizeof(s->w)); \
+} \
+\
+static inline SmallSet##N const * smallNeig##N(SmallGraph##N const * sg, int i) { \
+	return &sg->row[i]; \
+} \
+\
+static inline SmallGraph##N * newSmallGraph##N(Graph * g) { \
+	SmallGraph##N * sg = (SmallGraph##N *) memalign(sizeof(SmallSet##N), sizeof(SmallGraph##N)); \
+	int i; \
+	sg->n = g->n; \
+	for (i = 0; i < g->n; i++) \
+		smallFromBitMap##N(&sg->row[i], neig(g, i)); \
+	for (; i < N; i++) \
+		smallClear##N(&sg->row[i]); \
+	return sg; \
+} \
+\
+static inline void delSmallGraph##N(SmallGraph##N * sg) { \
+	free(sg); \
+}
+
+SMALLGRAPH_DEFINE(64, 1)
+SMALLGRAPH_DEFINE(128, 2)
+SMALLGRAPH_DEFINE(256, 4)
+
+#endif /* SMALLGRAPH_H_ */